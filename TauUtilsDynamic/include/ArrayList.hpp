@@ -6,6 +6,7 @@
 #pragma warning(pop)
 
 #include "NumTypes.hpp"
+#include "TUMaths.hpp"
 #include "allocator/PageAllocator.hpp"
 #include "allocator/TauAllocator.hpp"
 
@@ -42,15 +43,33 @@ namespace ArrayListUtils
  *     This is the number of reserved pages that have been
  *    committed. A committed page is one where the address
  *    space correlates to a real block of RAM.
+ * @element pageKind
+ *     The size of the pages backing the reservation. Large
+ *   pages reduce TLB misses when the array spans gigabytes.
+ * @element fileBacked
+ *     Whether the pages are mapped from a file, in which case
+ *   the control block is persisted along with the elements.
+ * @element magic
+ *     `FileMagic` in a file backed list, used along with the
+ *   other fields to recognize a file written by a matching list.
+ * @element elementSize
+ *     The size of an element of a file backed list.
  */
 struct CtrlBlockData
 {
     uSys refCount;
     uSys elementCount;
     uSys dataSize;
+    uSys numReservedPages;
     uSys committedPages;
+    PageKind pageKind;
+    bool fileBacked;
+    u64 magic;
+    uSys elementSize;
 };
 
+inline constexpr u64 FileMagic = 0x5453494C59415254; // "TRAYLIST"
+
 struct ControlBlock final
 {
     union
@@ -59,6 +78,16 @@ struct ControlBlock final
         char _alignment[64];
     };
 };
+
+static_assert(sizeof(CtrlBlockData) <= 64, "The control block data no longer fits in its padding.");
+
+inline void freeCtrlBlock(ControlBlock* const ctrlBlock) noexcept
+{
+    if(ctrlBlock->data.fileBacked)
+    { PageAllocator::FreeFile(ctrlBlock, ctrlBlock->data.numReservedPages); }
+    else
+    { PageAllocator::Free(ctrlBlock, ctrlBlock->data.numReservedPages, ctrlBlock->data.pageKind); }
+}
 }
 
 template<typename T>
@@ -81,7 +110,7 @@ public:
     inline ~ArrayListIterator() noexcept
     {
         if(_ctrlBlock && --_ctrlBlock->data.refCount == 0)
-        { PageAllocator::Free(_ctrlBlock); }
+        { ArrayListUtils::freeCtrlBlock(_ctrlBlock); }
     }
 
     inline ArrayListIterator(const ArrayListIterator<T>& copy) noexcept
@@ -181,7 +210,7 @@ public:
     inline ~ConstArrayListIterator() noexcept
     {
         if(_ctrlBlock && --_ctrlBlock->data.refCount == 0)
-        { PageAllocator::Free(_ctrlBlock); }
+        { ArrayListUtils::freeCtrlBlock(_ctrlBlock); }
     }
 
     inline ConstArrayListIterator(const ConstArrayListIterator<T>& copy) noexcept
@@ -202,7 +231,7 @@ public:
         { return *this; }
 
         if(--_ctrlBlock->data.refCount == 0)
-        { PageAllocator::Free(_ctrlBlock); }
+        { ArrayListUtils::freeCtrlBlock(_ctrlBlock); }
 
         _ctrlBlock = copy._ctrlBlock;
         _arr = copy._arr;
@@ -219,7 +248,7 @@ public:
         { return *this; }
 
         if(--_ctrlBlock->data.refCount == 0)
-        { PageAllocator::Free(_ctrlBlock); }
+        { ArrayListUtils::freeCtrlBlock(_ctrlBlock); }
 
         _ctrlBlock = move._ctrlBlock;
         _arr = move._arr;
@@ -284,15 +313,74 @@ private:
     ControlBlock* _ctrlBlock;
     T* _arr;
 public:
-    ArrayList(const uSys maxElements) noexcept
-        : _ctrlBlock(reinterpret_cast<ControlBlock*>(PageAllocator::Reserve((maxElements * sizeof(T)) / PageAllocator::PageSize() + 1)))
+    ArrayList(const uSys maxElements, const PageKind pageKind = PageKind::Normal) noexcept
+        : _ctrlBlock(reinterpret_cast<ControlBlock*>(PageAllocator::Reserve((maxElements * sizeof(T)) / PageAllocator::PageSize() + 1, pageKind)))
         , _arr(reinterpret_cast<T*>(_ctrlBlock + 1))
     {
         (void) PageAllocator::CommitPage(_ctrlBlock);
         _ctrlBlock->data.refCount = 1;
         _ctrlBlock->data.elementCount = 0;
         _ctrlBlock->data.dataSize = sizeof(ControlBlock);
+        _ctrlBlock->data.numReservedPages = (maxElements * sizeof(T)) / PageAllocator::PageSize() + 1;
         _ctrlBlock->data.committedPages = 1;
+        _ctrlBlock->data.pageKind = pageKind;
+        _ctrlBlock->data.fileBacked = false;
+    }
+
+    /**
+     *   Opens an array list persisted in the file at path, creating
+     * the file if it doesn't exist. Reopening a file is instant,
+     * the elements are used in place without any deserialization.
+     *
+     *   Because of this T must not hold pointers or any other state
+     * that is only valid within a single process. A file which
+     * wasn't written by a list with the same maxElements and
+     * element size is reinitialized as an empty list. If the file
+     * can't be opened `arr()` is null.
+     */
+    ArrayList(const char* const path, const uSys maxElements) noexcept
+        : _ctrlBlock(nullptr)
+        , _arr(nullptr)
+    {
+        const uSys numReservedPages = (maxElements * sizeof(T)) / PageAllocator::PageSize() + 1;
+        uSys existingBytes;
+
+        _ctrlBlock = reinterpret_cast<ControlBlock*>(PageAllocator::ReserveFile(path, numReservedPages, &existingBytes));
+
+        if(!_ctrlBlock)
+        { return; }
+
+        _arr = reinterpret_cast<T*>(_ctrlBlock + 1);
+
+        (void) PageAllocator::CommitPage(_ctrlBlock);
+
+        const ArrayListUtils::CtrlBlockData& stored = _ctrlBlock->data;
+
+        if(existingBytes >= sizeof(ControlBlock) &&
+           stored.fileBacked &&
+           stored.magic == ArrayListUtils::FileMagic &&
+           stored.elementSize == sizeof(T) &&
+           stored.numReservedPages == numReservedPages &&
+           stored.pageKind == PageKind::Normal &&
+           stored.elementCount <= maxElements &&
+           stored.dataSize == sizeof(ControlBlock) + stored.elementCount * sizeof(T))
+        {
+            // The committed pages must cover the elements, without leaving the reservation.
+            _ctrlBlock->data.committedPages = minT(maxT(stored.committedPages, stored.dataSize / PageAllocator::PageSize() + 1), numReservedPages);
+            (void) PageAllocator::CommitPages(_ctrlBlock, _ctrlBlock->data.committedPages);
+            _ctrlBlock->data.refCount = 1;
+            return;
+        }
+
+        _ctrlBlock->data.refCount = 1;
+        _ctrlBlock->data.elementCount = 0;
+        _ctrlBlock->data.dataSize = sizeof(ControlBlock);
+        _ctrlBlock->data.numReservedPages = numReservedPages;
+        _ctrlBlock->data.committedPages = 1;
+        _ctrlBlock->data.pageKind = PageKind::Normal;
+        _ctrlBlock->data.fileBacked = true;
+        _ctrlBlock->data.magic = ArrayListUtils::FileMagic;
+        _ctrlBlock->data.elementSize = sizeof(T);
     }
 
     ~ArrayList() noexcept
@@ -304,7 +392,7 @@ public:
                 _arr[i].~T();
             }
 
-            PageAllocator::Free(_ctrlBlock);
+            ArrayListUtils::freeCtrlBlock(_ctrlBlock);
         }
     }
 
@@ -350,6 +438,15 @@ public:
     [[nodiscard]] uSys   size() const noexcept { return _ctrlBlock->data.elementCount; }
     [[nodiscard]] uSys length() const noexcept { return _ctrlBlock->data.elementCount; }
 
+    /**
+     * Writes the list to its file, if it is file backed.
+     */
+    void flush() noexcept
+    {
+        if(_ctrlBlock->data.fileBacked)
+        { PageAllocator::FlushPages(_ctrlBlock, _ctrlBlock->data.committedPages); }
+    }
+
     void add(const T& val) noexcept
     {
         assertSize();
@@ -489,15 +586,18 @@ private:
     ControlBlock* _ctrlBlock;
     T* _arr;
 public:
-    ArrayList(const uSys maxElements) noexcept
-        : _ctrlBlock(reinterpret_cast<ControlBlock*>(PageAllocator::Reserve(maxElements / PageAllocator::PageSize() + 1)))
+    ArrayList(const uSys maxElements, const PageKind pageKind = PageKind::Normal) noexcept
+        : _ctrlBlock(reinterpret_cast<ControlBlock*>(PageAllocator::Reserve(maxElements / PageAllocator::PageSize() + 1, pageKind)))
         , _arr(reinterpret_cast<T*>(_ctrlBlock + 1))
     {
         (void)PageAllocator::CommitPage(_ctrlBlock);
         _ctrlBlock->data.refCount = 1;
         _ctrlBlock->data.elementCount = 0;
         _ctrlBlock->data.dataSize = sizeof(ControlBlock);
+        _ctrlBlock->data.numReservedPages = maxElements / PageAllocator::PageSize() + 1;
         _ctrlBlock->data.committedPages = 1;
+        _ctrlBlock->data.pageKind = pageKind;
+        _ctrlBlock->data.fileBacked = false;
     }
 
     ~ArrayList() noexcept
@@ -509,7 +609,7 @@ public:
                 _arr[i].~_T();
             }
 
-            PageAllocator::Free(_ctrlBlock);
+            ArrayListUtils::freeCtrlBlock(_ctrlBlock);
         }
     }
 
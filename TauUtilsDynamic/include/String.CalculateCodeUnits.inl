@@ -6,6 +6,11 @@
 
 #include "NumTypes.hpp"
 
+// The counts below alternate between a vectorized pass, which
+// classifies whole chunks at once and stops at anything it can't
+// prove well formed, and the scalar loop, which counts the next
+// chunk's worth of code units before the vector pass tries again.
+
 namespace tau::string {
 
 namespace utf8 {
@@ -20,27 +25,36 @@ template<typename C32Alias = c32>
     { return -1; }
 
     iSys outCodeUnits = priorCodeUnits;
-    for(iSys i = startCodeUnit; i < inCodeUnits; ++i)
+    iSys utf16CodeUnits = 0;
+    for(iSys i = startCodeUnit; i < inCodeUnits;)
     {
-        if(inString[i] <= 0x7F) // 1 Byte
-        {
-            ++outCodeUnits;
-        }
-        else if(inString[i] <= 0x07FF) // 2 Bytes
-        {
-            outCodeUnits += 2;
-        }
-        else if(inString[i] <= 0xFFFF) // 3 Bytes
-        {
-            outCodeUnits += 3;
-        }
-        else if(inString[i] <= 0x10FFFF) // 4 Bytes
+        if constexpr(sizeof(C32Alias) == sizeof(c32))
         {
-            outCodeUnits += 4;
+            i += simd::CountUtf32(inString + i, inCodeUnits - i, outCodeUnits, utf16CodeUnits);
         }
-        else
+
+        for(const iSys chunkEnd = minT(i + static_cast<iSys>(simd::ChunkSize), inCodeUnits); i < chunkEnd; ++i)
         {
-            return -1;
+            if(inString[i] <= 0x7F) // 1 Byte
+            {
+                ++outCodeUnits;
+            }
+            else if(inString[i] <= 0x07FF) // 2 Bytes
+            {
+                outCodeUnits += 2;
+            }
+            else if(inString[i] <= 0xFFFF) // 3 Bytes
+            {
+                outCodeUnits += 3;
+            }
+            else if(inString[i] <= 0x10FFFF) // 4 Bytes
+            {
+                outCodeUnits += 4;
+            }
+            else
+            {
+                return -1;
+            }
         }
     }
     return outCodeUnits;
@@ -67,29 +81,35 @@ template<typename C8Alias = c8>
     }
 
     iSys outCodePoints = priorCodePoints;
+    iSys utf16CodeUnits = 0;
     for(iSys i = startingIndex; i < inCodeUnits;)
     {
-        if((inString[i] & 0x80) == 0) // 1 Byte
-        {
-            ++i;
-        }
-        else if((inString[i] & 0xE0) == 0xC0) // 2 Bytes
-        {
-            i += 2;
-        }
-        else if((inString[i] & 0xF0) == 0xE0) // 3 Bytes
-        {
-            i += 3;
-        }
-        else if((inString[i] & 0xF8) == 0xF0) // 4 Bytes
-        {
-            i += 4;
-        }
-        else
+        i += simd::CountUtf8(inString + i, inCodeUnits - i, outCodePoints, utf16CodeUnits);
+
+        for(const iSys chunkEnd = minT(i + static_cast<iSys>(simd::ChunkSize), inCodeUnits); i < chunkEnd;)
         {
-            return -1;
+            if((inString[i] & 0x80) == 0) // 1 Byte
+            {
+                ++i;
+            }
+            else if((inString[i] & 0xE0) == 0xC0) // 2 Bytes
+            {
+                i += 2;
+            }
+            else if((inString[i] & 0xF0) == 0xE0) // 3 Bytes
+            {
+                i += 3;
+            }
+            else if((inString[i] & 0xF8) == 0xF0) // 4 Bytes
+            {
+                i += 4;
+            }
+            else
+            {
+                return -1;
+            }
+            ++outCodePoints;
         }
-        ++outCodePoints;
     }
     return outCodePoints;
 }
@@ -108,19 +128,28 @@ template<typename C32Alias = c32>
     { return -1; }
 
     iSys outCodeUnits = priorCodeUnits + (skipBom ? 0 : 1);
-    for(iSys i = startCodeUnit; i < inCodeUnits; ++i)
+    iSys utf8CodeUnits = 0;
+    for(iSys i = startCodeUnit; i < inCodeUnits;)
     {
-        if(inString[i] <= 0xD7FF || (inString[i] >= 0xE000 && inString[i] <= 0xFFFF)) // 1 Short
+        if constexpr(sizeof(C32Alias) == sizeof(c32))
         {
-            ++outCodeUnits;
+            i += simd::CountUtf32(inString + i, inCodeUnits - i, utf8CodeUnits, outCodeUnits);
         }
-        else if(inString[i] <= 0x10FFFF) // 2 Shorts
-        {
-            outCodeUnits += 2;
-        }
-        else
+
+        for(const iSys chunkEnd = minT(i + static_cast<iSys>(simd::ChunkSize), inCodeUnits); i < chunkEnd; ++i)
         {
-            return -1;
+            if(inString[i] <= 0xD7FF || (inString[i] >= 0xE000 && inString[i] <= 0xFFFF)) // 1 Short
+            {
+                ++outCodeUnits;
+            }
+            else if(inString[i] <= 0x10FFFF) // 2 Shorts
+            {
+                outCodeUnits += 2;
+            }
+            else
+            {
+                return -1;
+            }
         }
     }
     return outCodeUnits;
@@ -151,32 +180,44 @@ template<typename C16Alias = c16>
     }
 
     iSys outCodePoints = priorCodePoints;
+    iSys utf8CodeUnits = 0;
     for(iSys i = startingIndex; i < inCodeUnits;)
     {
-        if(!flipEndian)
+        if constexpr(sizeof(C16Alias) == sizeof(c16))
         {
-            if(inString[i] <= 0xD7FF || inString[i] >= 0xE000) // 1 Short
-            {
-                ++i;
-            }
-            else // 2 Shorts
+            if(!flipEndian)
             {
-                i += 2;
+                i += simd::CountUtf16(inString + i, inCodeUnits - i, outCodePoints, utf8CodeUnits);
             }
         }
-        else
+
+        for(const iSys chunkEnd = minT(i + static_cast<iSys>(simd::ChunkSize), inCodeUnits); i < chunkEnd;)
         {
-            const uSys lowByte = inString[i] & 0xFF;
-            if(lowByte <= 0xD7 || (lowByte >= 0xE0 && lowByte <= 0xFF)) // 1 Short
+            if(!flipEndian)
             {
-                ++i;
+                if(inString[i] <= 0xD7FF || inString[i] >= 0xE000) // 1 Short
+                {
+                    ++i;
+                }
+                else // 2 Shorts
+                {
+                    i += 2;
+                }
             }
-            else // 2 Shorts
+            else
             {
-                i += 2;
+                const uSys lowByte = inString[i] & 0xFF;
+                if(lowByte <= 0xD7 || (lowByte >= 0xE0 && lowByte <= 0xFF)) // 1 Short
+                {
+                    ++i;
+                }
+                else // 2 Shorts
+                {
+                    i += 2;
+                }
             }
+            ++outCodePoints;
         }
-        ++outCodePoints;
     }
     return outCodePoints;
 }
@@ -206,43 +247,39 @@ template<typename C8Alias = c8>
     }
 
     iSys outCodeUnits = priorCodeUnits + (skipBom ? 0 : 1); // Prior code points, plus BOM
+    iSys codePoints = 0;
     for(iSys i = startingIndex; i < inCodeUnits;)
     {
-        if((inString[i] & 0x80) == 0) // 1 Byte
-        {
-            ++i;
-            ++outCodeUnits;
-        }
-        else if((inString[i] & 0xE0) == 0xC0) // 2 Bytes
+        if constexpr(sizeof(C8Alias) == sizeof(c8))
         {
-            i += 2;
-            ++outCodeUnits;
+            i += simd::CountUtf8(inString + i, inCodeUnits - i, codePoints, outCodeUnits);
         }
-        else if((inString[i] & 0xF0) == 0xE0) // 3 Bytes
+
+        for(const iSys chunkEnd = minT(i + static_cast<iSys>(simd::ChunkSize), inCodeUnits); i < chunkEnd;)
         {
-            i += 3;
-            if(i + 3 >= inCodeUnits)
+            if((inString[i] & 0x80) == 0) // 1 Byte
             {
-                const c32 val = static_cast<c32>((inString[i] << 16) | (inString[i + 1] << 8) | inString[i + 2]);
-
-                // The min and max bits of a surrogate pair interlaced with UTF8 encoding bits.
-                if(val >= 0xED9F8F && val <= 0xEE8080)
-                {
-                    outCodeUnits += 2;
-                }
-                else
-                {
-                    ++outCodeUnits;
-                }
+                ++i;
+                ++outCodeUnits;
             }
+            else if((inString[i] & 0xE0) == 0xC0) // 2 Bytes
+            {
+                i += 2;
+                ++outCodeUnits;
+            }
+            else if((inString[i] & 0xF0) == 0xE0) // 3 Bytes, never more than U+FFFF
+            {
+                i += 3;
+                ++outCodeUnits;
+            }
+            else if((inString[i] & 0xF8) == 0xF0) // 4 Bytes
+            {
+                i += 4;
+                outCodeUnits += 2;
+            }
+            else
+            { return -1; }
         }
-        else if((inString[i] & 0xF8) == 0xF0) // 4 Bytes
-        {
-            i += 4;
-            outCodeUnits += 2;
-        }
-        else
-        { return -1; }
     }
     return outCodeUnits;
 }
@@ -272,45 +309,35 @@ template<typename C16Alias = c16>
     }
 
     iSys outCodeUnits = priorCodeUnits + (skipBom ? 0 : 3); // Prior code points
+    iSys codePoints = 0;
     for(iSys i = startingIndex; i < inCodeUnits;)
     {
-        if(!flipEndian)
+        if constexpr(sizeof(C16Alias) == sizeof(c16))
         {
-            if(inString[i] <= 0xD7FF || inString[i] >= 0xE000) // 1 Short
+            if(!flipEndian)
             {
-                ++i;
-
-                if(inString[i] <= 0x7F)
-                {
-                    ++outCodeUnits;
-                }
-                else if(inString[1] <= 0x7FF)
-                {
-                    outCodeUnits += 2;
-                }
-                else
-                {
-                    outCodeUnits += 3;
-                }
-            }
-            else // 2 Shorts
-            {
-                i += 2;
-                outCodeUnits += 4;
+                i += simd::CountUtf16(inString + i, inCodeUnits - i, codePoints, outCodeUnits);
             }
         }
-        else
+
+        for(const iSys chunkEnd = minT(i + static_cast<iSys>(simd::ChunkSize), inCodeUnits); i < chunkEnd;)
         {
-            const uSys lowByte = inString[i] & 0xFF;
-            if(lowByte <= 0xD7 || (lowByte >= 0xE0 && lowByte <= 0xFF)) // 1 Short
+            uSys c = static_cast<uSys>(inString[i]) & 0xFFFF;
+
+            if(flipEndian)
+            {
+                c = ((c << 8) | (c >> 8)) & 0xFFFF;
+            }
+
+            if(c <= 0xD7FF || c >= 0xE000) // 1 Short
             {
                 ++i;
 
-                if((inString[i] >> 8) <= 0x7F)
+                if(c <= 0x7F)
                 {
                     ++outCodeUnits;
                 }
-                else if(lowByte <= 0x07)
+                else if(c <= 0x7FF)
                 {
                     outCodeUnits += 2;
                 }
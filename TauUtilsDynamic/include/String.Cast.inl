@@ -8,40 +8,43 @@ template<>
 inline DynStringT<c32> StringCast(const DynStringT<c8>& string) noexcept
 {
     const c8* const rawStr = string.String();
+    const iSys inLen = static_cast<iSys>(string.Length());
 
-    const iSys len = tau::string::utf8::CalculateCodePoints(rawStr, static_cast<iSys>(string.Length()));
-
-    if(len < 0)
-    {
-        return DynStringT<c32>();
-    }
-
-    if(len < 16)
+    // No code point takes more code units in UTF-32 than it did in the input,
+    // so a buffer the length of the input is transcoded into in a single pass,
+    // instead of counting the code points first.
+    if(inLen < 16)
     {
         c32 newStr[16];
-        newStr[len] = U'\0';
 
-        if(tau::string::utf8::Transform(rawStr, newStr, static_cast<iSys>(string.Length()), len) <= 0)
+        const iSys len = tau::string::utf8::Transform(rawStr, newStr, inLen, inLen);
+
+        if(len <= 0)
         {
             return DynStringT<c32>();
         }
 
+        newStr[len] = U'\0';
+
         return DynStringT(static_cast<const c32*>(newStr));
     }
     else
     {
-        void* const placement = ::TauUtilsAllocate(sizeof(ReferenceCounter::Type) + (len + 1) * sizeof(c32));
+        void* const placement = ::TauUtilsAllocate(sizeof(ReferenceCounter::Type) + (inLen + 1) * sizeof(c32));
 
         ReferenceCounter::Type* const refCount = ::new(placement) ReferenceCounter::Type(1);
-        c32* const newStr = ::new(refCount + 1) c32[len + 1];
-        newStr[len] = U'\0';
+        c32* const newStr = ::new(refCount + 1) c32[inLen + 1];
 
-        if(tau::string::utf8::Transform(rawStr, newStr, static_cast<iSys>(string.Length()), 16) <= 0)
+        const iSys len = tau::string::utf8::Transform(rawStr, newStr, inLen, inLen);
+
+        if(len <= 0)
         {
             ::TauUtilsDeallocate(placement);
             return DynStringT<c32>();
         }
 
+        newStr[len] = U'\0';
+
         return DynStringT<c32>::passControl(refCount, newStr, len, [](const c32* str) { }, [](ReferenceCounter::Type* refCount) { ::TauUtilsDeallocate(refCount); });
     }
 }
@@ -92,29 +95,29 @@ template<>
 inline DynStringT<c32> StringCast(const DynStringT<c16>& string) noexcept
 {
     const c16* const rawStr = string.String();
+    const iSys inLen = static_cast<iSys>(string.Length());
 
-    const iSys len = tau::string::utf16::CalculateCodePoints(rawStr, static_cast<iSys>(string.Length()));
-
-    if(len < 0)
-    {
-        return DynStringT<c32>();
-    }
-
-    if(len < 16)
+    // No code point takes more code units in UTF-32 than it did in the input,
+    // so a buffer the length of the input is transcoded into in a single pass,
+    // instead of counting the code points first.
+    if(inLen < 16)
     {
         c32 newStr[16];
-        newStr[len] = U'\0';
 
-        if(tau::string::utf16::Transform(rawStr, newStr, static_cast<iSys>(string.Length()), len) <= 0)
+        const iSys len = tau::string::utf16::Transform(rawStr, newStr, inLen, inLen);
+
+        if(len <= 0)
         {
             return DynStringT<c32>();
         }
 
+        newStr[len] = U'\0';
+
         return DynStringT(static_cast<const c32*>(newStr));
     }
     else
     {
-        void* const placement = ::TauUtilsAllocate(sizeof(ReferenceCounter::Type) + (len + 1) * sizeof(c32));
+        void* const placement = ::TauUtilsAllocate(sizeof(ReferenceCounter::Type) + (inLen + 1) * sizeof(c32));
 
         if(!placement)
         {
@@ -122,15 +125,18 @@ inline DynStringT<c32> StringCast(const DynStringT<c16>& string) noexcept
         }
 
         ReferenceCounter::Type* const refCount = ::new(placement) ReferenceCounter::Type(1);
-        c32* const newStr = ::new(refCount + 1) c32[len + 1];
-        newStr[len] = U'\0';
+        c32* const newStr = ::new(refCount + 1) c32[inLen + 1];
+
+        const iSys len = tau::string::utf16::Transform(rawStr, newStr, inLen, inLen);
 
-        if(tau::string::utf16::Transform(rawStr, newStr, static_cast<iSys>(string.Length()), 16) <= 0)
+        if(len <= 0)
         {
             ::TauUtilsDeallocate(placement);
             return DynStringT<c32>();
         }
 
+        newStr[len] = U'\0';
+
         return DynStringT<c32>::passControl(refCount, newStr, len, [](const c32* str) { }, [](ReferenceCounter::Type* refCount) { ::TauUtilsDeallocate(refCount); });
     }
 }
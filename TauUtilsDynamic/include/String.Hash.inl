@@ -0,0 +1,333 @@
+#pragma once
+
+#if defined(STRING_IN_DEV) || 0
+#include "String.hpp"
+#endif
+
+#include "NumTypes.hpp"
+
+#pragma warning(push, 0)
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <type_traits>
+#pragma warning(pop)
+
+namespace tau::string {
+
+/**
+ *   The hash used for every string's `HashCode`.
+ *
+ *   By default this is a wyhash style hash, consuming 8 bytes at
+ * a time and folding them together with 64 bit multiplies, so
+ * every bit of the input influences every bit of the output.
+ * Strings are hashed as the little endian bytes of their code
+ * units, a string hashes the same at compile time and at run
+ * time, which `STR_SWITCH` relies on.
+ *
+ *   Defining `TAU_USE_LEGACY_STRING_HASH` switches back to the
+ * old `31 * hash + c` hash, for builds which have persisted
+ * hash codes.
+ *
+ *   When `TAU_LAZY_STRING_HASH` is defined 0 is reserved to mark
+ * a hash which hasn't been computed yet, a string hashing to 0
+ * is given 1 instead.
+ */
+namespace hash {
+
+inline constexpr u64 Secret0 = 0x2D358DCCAA6C78A5ull;
+inline constexpr u64 Secret1 = 0x8BB84B93962EACC9ull;
+inline constexpr u64 Secret2 = 0x4B33A62ED433D4A3ull;
+inline constexpr u64 Secret3 = 0x4D5A2DA51DE1AA47ull;
+
+/**
+ * Replaces a and b with the low and high halves of their 128 bit product.
+ */
+inline constexpr void Mum(u64& a, u64& b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    a = static_cast<u64>(product);
+    b = static_cast<u64>(product >> 64);
+#else
+    const u64 aLow = a & 0xFFFFFFFFull;
+    const u64 aHigh = a >> 32;
+    const u64 bLow = b & 0xFFFFFFFFull;
+    const u64 bHigh = b >> 32;
+
+    const u64 lowLow = aLow * bLow;
+    const u64 lowHigh = aLow * bHigh;
+    const u64 highLow = aHigh * bLow;
+    const u64 highHigh = aHigh * bHigh;
+
+    const u64 middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFFull) + (highLow & 0xFFFFFFFFull);
+
+    a = (lowLow & 0xFFFFFFFFull) | (middle << 32);
+    b = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+#endif
+}
+
+[[nodiscard]] inline constexpr u64 Mix(u64 a, u64 b) noexcept
+{
+    Mum(a, b);
+    return a ^ b;
+}
+
+/**
+ * Byte index of a string, counting bytes within a code unit from the least significant.
+ */
+template<typename Char>
+[[nodiscard]] inline constexpr u64 ByteAt(const Char* const str, const uSys index) noexcept
+{
+    using UChar = ::std::make_unsigned_t<Char>;
+    return static_cast<u8>(static_cast<u64>(static_cast<UChar>(str[index / sizeof(Char)])) >> ((index % sizeof(Char)) * 8));
+}
+
+template<typename Char, uSys Count>
+[[nodiscard]] inline constexpr u64 ReadBytes(const Char* const str, const uSys index) noexcept
+{
+    if constexpr(::std::endian::native == ::std::endian::little)
+    {
+        if(!::std::is_constant_evaluated())
+        {
+            u64 ret = 0;
+            ::std::memcpy(&ret, reinterpret_cast<const u8*>(str) + index, Count);
+            return ret;
+        }
+    }
+
+    u64 ret = 0;
+    for(uSys i = 0; i < Count; ++i)
+    {
+        ret |= ByteAt(str, index + i) << (i * 8);
+    }
+    return ret;
+}
+
+template<typename Char>
+[[nodiscard]] inline constexpr u64 Read8(const Char* const str, const uSys index) noexcept
+{ return ReadBytes<Char, 8>(str, index); }
+
+template<typename Char>
+[[nodiscard]] inline constexpr u64 Read4(const Char* const str, const uSys index) noexcept
+{ return ReadBytes<Char, 4>(str, index); }
+
+/**
+ * Reads 1 to 3 bytes.
+ */
+template<typename Char>
+[[nodiscard]] inline constexpr u64 Read3(const Char* const str, const uSys length) noexcept
+{ return (ByteAt(str, 0) << 16) | (ByteAt(str, length >> 1) << 8) | ByteAt(str, length - 1); }
+
+template<typename Char>
+[[nodiscard]] inline constexpr u64 Hash64(const Char* const str, const uSys codeUnits, u64 seed = 0) noexcept
+{
+    const uSys length = codeUnits * sizeof(Char);
+
+    seed ^= Mix(seed ^ Secret0, Secret1);
+
+    u64 a;
+    u64 b;
+
+    if(length <= 16)
+    {
+        if(length >= 4)
+        {
+            // Two possibly overlapping reads from each end.
+            const uSys quarter = (length >> 3) << 2;
+            a = (Read4(str, 0) << 32) | Read4(str, quarter);
+            b = (Read4(str, length - 4) << 32) | Read4(str, length - 4 - quarter);
+        }
+        else if(length > 0)
+        {
+            a = Read3(str, length);
+            b = 0;
+        }
+        else
+        {
+            a = 0;
+            b = 0;
+        }
+    }
+    else
+    {
+        uSys index = 0;
+        uSys remaining = length;
+
+        if(remaining > 48)
+        {
+            // Three independent lanes, so the multiplies can overlap.
+            u64 seed1 = seed;
+            u64 seed2 = seed;
+
+            do
+            {
+                seed = Mix(Read8(str, index) ^ Secret1, Read8(str, index + 8) ^ seed);
+                seed1 = Mix(Read8(str, index + 16) ^ Secret2, Read8(str, index + 24) ^ seed1);
+                seed2 = Mix(Read8(str, index + 32) ^ Secret3, Read8(str, index + 40) ^ seed2);
+                index += 48;
+                remaining -= 48;
+            } while(remaining > 48);
+
+            seed ^= seed1 ^ seed2;
+        }
+
+        while(remaining > 16)
+        {
+            seed = Mix(Read8(str, index) ^ Secret1, Read8(str, index + 8) ^ seed);
+            index += 16;
+            remaining -= 16;
+        }
+
+        // The last 16 bytes, overlapping the previous block if needed.
+        a = Read8(str, index + remaining - 16);
+        b = Read8(str, index + remaining - 8);
+    }
+
+    a ^= Secret1;
+    b ^= seed;
+    Mum(a, b);
+    return Mix(a ^ Secret0 ^ length, b ^ Secret1);
+}
+
+template<typename Char>
+[[nodiscard]] inline constexpr uSys HashString(const Char* const str, const uSys length) noexcept
+{
+#ifdef TAU_USE_LEGACY_STRING_HASH
+    uSys hash = 0;
+    for(uSys i = 0; i < length; ++i)
+    {
+        hash = 31u * hash + static_cast<uSys>(str[i]);
+    }
+#else
+    const uSys hash = static_cast<uSys>(Hash64(str, length));
+#endif
+
+#ifdef TAU_LAZY_STRING_HASH
+    return hash == 0 ? 1 : hash;
+#else
+    return hash;
+#endif
+}
+
+}
+
+/**
+ *   The hash code stored in a `DynStringT` or `DynStringViewT`.
+ *
+ *   By default the hash is computed when the string is created.
+ * Defining `TAU_LAZY_STRING_HASH` defers it to the first call
+ * to `HashCode`, so strings which are never hashed, such as log
+ * lines, never pay for it. The computed hash is cached, it is
+ * published with a relaxed atomic store, every thread computes
+ * the same value so a race only costs a redundant hash.
+ */
+class StringHashCache final
+{
+    DEFAULT_DESTRUCT_C(StringHashCache);
+public:
+#ifdef TAU_LAZY_STRING_HASH
+    static constexpr bool IsLazy = true;
+#else
+    static constexpr bool IsLazy = false;
+#endif
+
+    /**
+     * The value of a hash which hasn't been computed, only used when lazy.
+     */
+    static constexpr uSys Unset = 0;
+public:
+    template<typename Char>
+    constexpr StringHashCache(const Char* const str, const uSys length) noexcept
+        : m_Hash(IsLazy ? Unset : hash::HashString(str, length))
+    { }
+
+    /**
+     * Reuses the hash of another string with the same contents, which may be `Unset`.
+     */
+    constexpr explicit StringHashCache(const uSys hash) noexcept
+        : m_Hash(hash)
+    { }
+
+    constexpr StringHashCache(const StringHashCache& copy) noexcept
+        : m_Hash(copy.Peek())
+    { }
+
+    constexpr StringHashCache& operator=(const StringHashCache& copy) noexcept
+    {
+        if(this != &copy)
+        {
+            Publish(copy.Peek());
+        }
+
+        return *this;
+    }
+
+    /**
+     * The hash of str, which must be the string this was created for.
+     */
+    template<typename Char>
+    [[nodiscard]] constexpr uSys Get(const Char* const str, const uSys length) const noexcept
+    {
+        if constexpr(!IsLazy)
+        {
+            return m_Hash;
+        }
+        else
+        {
+            uSys hash = Peek();
+
+            if(hash == Unset)
+            {
+                hash = hash::HashString(str, length);
+                Publish(hash);
+            }
+
+            return hash;
+        }
+    }
+
+    /**
+     * The hash if it has been computed, otherwise `Unset`.
+     */
+    [[nodiscard]] constexpr uSys Peek() const noexcept
+    {
+        if(::std::is_constant_evaluated())
+        {
+            return m_Hash;
+        }
+
+        return ::std::atomic_ref<uSys>(m_Hash).load(::std::memory_order_relaxed);
+    }
+
+    /**
+     *   Whether two hashes show their strings differ. An uncomputed
+     * hash is never considered different.
+     */
+    [[nodiscard]] static constexpr bool Differ(const uSys lhs, const uSys rhs) noexcept
+    {
+        if constexpr(IsLazy)
+        {
+            return lhs != Unset && rhs != Unset && lhs != rhs;
+        }
+        else
+        {
+            return lhs != rhs;
+        }
+    }
+private:
+    constexpr void Publish(const uSys hash) const noexcept
+    {
+        if(::std::is_constant_evaluated())
+        {
+            m_Hash = hash;
+            return;
+        }
+
+        ::std::atomic_ref<uSys>(m_Hash).store(hash, ::std::memory_order_relaxed);
+    }
+private:
+    mutable uSys m_Hash;
+};
+
+}
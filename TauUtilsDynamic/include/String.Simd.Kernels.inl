@@ -0,0 +1,372 @@
+// Intentionally no #pragma once, String.Simd.inl includes this once
+// for each instruction set, inside a namespace which provides:
+//   Vector, Width, Load, LoadAligned, And, Splat<Char>, EqualMask<Char>,
+//   NarrowAscii<Char> and WidenAscii<Char>.
+//
+// EqualMask returns a bit per byte, so a code unit which matches sets
+// sizeof(Char) consecutive bits.
+
+template<typename Char>
+[[nodiscard]] inline uSys Length(const Char* const str) noexcept
+{
+    // Aligned loads never cross a page, so reading past the terminator is safe.
+    const uPtr address = reinterpret_cast<uPtr>(str);
+    const u8* block = reinterpret_cast<const u8*>(address & ~static_cast<uPtr>(Width - 1));
+    const Vector zero = Splat<Char>(Char { 0 });
+
+    u32 mask = EqualMask<Char>(LoadAligned(block), zero) >> (address & (Width - 1));
+
+    if(mask)
+    {
+        return static_cast<uSys>(::std::countr_zero(mask)) / sizeof(Char);
+    }
+
+    while(true)
+    {
+        block += Width;
+        mask = EqualMask<Char>(LoadAligned(block), zero);
+
+        if(mask)
+        {
+            return (static_cast<uSys>(block - reinterpret_cast<const u8*>(str)) + static_cast<uSys>(::std::countr_zero(mask))) / sizeof(Char);
+        }
+    }
+}
+
+template<typename Char>
+[[nodiscard]] inline uSys Mismatch(const Char* const lhs, const Char* const rhs, const uSys length) noexcept
+{
+    constexpr uSys Units = Width / sizeof(Char);
+    constexpr u32 AllBits = static_cast<u32>((static_cast<u64>(1) << Width) - 1);
+
+    uSys i = 0;
+
+    for(; i + Units <= length; i += Units)
+    {
+        if(const u32 mask = ~EqualMask<Char>(Load(lhs + i), Load(rhs + i)) & AllBits; mask)
+        {
+            return i + static_cast<uSys>(::std::countr_zero(mask)) / sizeof(Char);
+        }
+    }
+
+    if(i == length)
+    {
+        return length;
+    }
+
+    if(length < Units)
+    {
+        return i + scalar::Mismatch(lhs + i, rhs + i, length - i);
+    }
+
+    // Finish with a vector overlapping the last one.
+    i = length - Units;
+
+    if(const u32 mask = ~EqualMask<Char>(Load(lhs + i), Load(rhs + i)) & AllBits; mask)
+    {
+        return i + static_cast<uSys>(::std::countr_zero(mask)) / sizeof(Char);
+    }
+
+    return length;
+}
+
+template<typename Char>
+[[nodiscard]] inline i32 Compare(const Char* const lhs, const Char* const rhs) noexcept
+{
+    using UChar = ::std::make_unsigned_t<Char>;
+
+    constexpr uSys Units = Width / sizeof(Char);
+    constexpr u32 AllBits = static_cast<u32>((static_cast<u64>(1) << Width) - 1);
+    // The smallest page size, a vector which starts no later than
+    // this into a page can't touch the next one.
+    constexpr uPtr PageSize = 4096;
+    constexpr uPtr LastSafeOffset = PageSize - Width;
+
+    const Vector zero = Splat<Char>(Char { 0 });
+    uSys i = 0;
+
+    while(true)
+    {
+        const uPtr lhsOffset = reinterpret_cast<uPtr>(lhs + i) & (PageSize - 1);
+        const uPtr rhsOffset = reinterpret_cast<uPtr>(rhs + i) & (PageSize - 1);
+
+        if(lhsOffset <= LastSafeOffset && rhsOffset <= LastSafeOffset)
+        {
+            const Vector block = Load(lhs + i);
+            const u32 mask = (~EqualMask<Char>(block, Load(rhs + i)) & AllBits) | EqualMask<Char>(block, zero);
+
+            if(!mask)
+            {
+                i += Units;
+                continue;
+            }
+
+            i += static_cast<uSys>(::std::countr_zero(mask)) / sizeof(Char);
+        }
+        else if(lhs[i] && lhs[i] == rhs[i])
+        {
+            // A vector would cross a page, step over a single code unit.
+            ++i;
+            continue;
+        }
+
+        const UChar l = static_cast<UChar>(lhs[i]);
+        const UChar r = static_cast<UChar>(rhs[i]);
+        return l == r ? 0 : (l < r ? -1 : 1);
+    }
+}
+
+template<typename Char>
+[[nodiscard]] inline uSys Find(const Char* const str, const uSys length, const Char c) noexcept
+{
+    constexpr uSys Units = Width / sizeof(Char);
+
+    const Vector target = Splat<Char>(c);
+    uSys i = 0;
+
+    for(; i + Units <= length; i += Units)
+    {
+        if(const u32 mask = EqualMask<Char>(Load(str + i), target); mask)
+        {
+            return i + static_cast<uSys>(::std::countr_zero(mask)) / sizeof(Char);
+        }
+    }
+
+    if(i == length)
+    {
+        return length;
+    }
+
+    if(length < Units)
+    {
+        return i + scalar::Find(str + i, length - i, c);
+    }
+
+    i = length - Units;
+
+    if(const u32 mask = EqualMask<Char>(Load(str + i), target); mask)
+    {
+        return i + static_cast<uSys>(::std::countr_zero(mask)) / sizeof(Char);
+    }
+
+    return length;
+}
+
+/**
+ *   Finds needle by matching its first and last code units
+ * against a vector of candidate positions at once, only the
+ * candidates where both match are compared in full.
+ */
+template<typename Char>
+[[nodiscard]] inline uSys Find(const Char* const str, const uSys length, const Char* const needle, const uSys needleLength) noexcept
+{
+    if(needleLength == 0)
+    {
+        return 0;
+    }
+
+    if(needleLength > length)
+    {
+        return length;
+    }
+
+    if(needleLength == 1)
+    {
+        return Find(str, length, needle[0]);
+    }
+
+    constexpr uSys Units = Width / sizeof(Char);
+    constexpr u32 UnitBits = (1u << sizeof(Char)) - 1;
+
+    const Vector first = Splat<Char>(needle[0]);
+    const Vector last = Splat<Char>(needle[needleLength - 1]);
+    const uSys candidates = length - needleLength + 1;
+
+    uSys i = 0;
+
+    for(; i + Units <= candidates; i += Units)
+    {
+        u32 mask = EqualMask<Char>(Load(str + i), first) & EqualMask<Char>(Load(str + i + needleLength - 1), last);
+
+        while(mask)
+        {
+            const u32 bit = static_cast<u32>(::std::countr_zero(mask));
+            const uSys index = i + bit / sizeof(Char);
+
+            if(Mismatch(str + index + 1, needle + 1, needleLength - 2) == needleLength - 2)
+            {
+                return index;
+            }
+
+            mask &= ~(UnitBits << bit);
+        }
+    }
+
+    for(; i < candidates; ++i)
+    {
+        if(str[i] == needle[0] && Mismatch(str + i + 1, needle + 1, needleLength - 1) == needleLength - 1)
+        {
+            return i;
+        }
+    }
+
+    return length;
+}
+
+template<typename CharIn, typename CharOut>
+[[nodiscard]] inline uSys TranscodeAscii(const CharIn* const in, CharOut* const out, const uSys length, const bool flipEndian) noexcept
+{
+    uSys i = 0;
+    Vector bytes;
+
+    for(; i + Width <= length && NarrowAscii(in + i, bytes); i += Width)
+    {
+        WidenAscii(bytes, out + i, flipEndian);
+    }
+
+    return i;
+}
+
+/**
+ *   Classifies a chunk of 64 bytes, setting the bits of the code
+ * units where (unit & mask) == value. Every code unit sets
+ * sizeof(Unit) bits.
+ */
+template<typename Unit>
+[[nodiscard]] inline u64 ChunkMaskedEqual(const u8* const p, const Unit mask, const Unit value) noexcept
+{
+    const Vector maskVector = Splat<Unit>(mask);
+    const Vector valueVector = Splat<Unit>(value);
+
+    u64 ret = 0;
+
+    for(uSys i = 0; i < ChunkSize / Width; ++i)
+    {
+        ret |= static_cast<u64>(EqualMask<Unit>(And(Load(p + i * Width), maskVector), valueVector)) << (i * Width);
+    }
+
+    return ret;
+}
+
+inline uSys CountUtf8(const u8* const in, const uSys length, iSys& codePoints, iSys& utf16CodeUnits) noexcept
+{
+    uSys i = 0;
+
+    while(i + ChunkSize <= length)
+    {
+        const u8* const p = in + i;
+        const u64 ascii = ChunkMaskedEqual<u8>(p, 0x80, 0x00);
+
+        if(ascii == ~0ull)
+        {
+            codePoints += static_cast<iSys>(ChunkSize);
+            utf16CodeUnits += static_cast<iSys>(ChunkSize);
+            i += ChunkSize;
+            continue;
+        }
+
+        const u64 continuation = ChunkMaskedEqual<u8>(p, 0xC0, 0x80);
+        const u64 lead2 = ChunkMaskedEqual<u8>(p, 0xE0, 0xC0);
+        const u64 lead3 = ChunkMaskedEqual<u8>(p, 0xF0, 0xE0);
+        const u64 lead4 = ChunkMaskedEqual<u8>(p, 0xF8, 0xF0);
+        const u64 invalid = ChunkMaskedEqual<u8>(p, 0xF8, 0xF8);
+
+        const u64 lead234 = lead2 | lead3 | lead4;
+        const u64 lead34 = lead3 | lead4;
+
+        // Every continuation byte must be one a lead byte asked for.
+        if(invalid || ((lead234 << 1) | (lead34 << 2) | (lead4 << 3)) != continuation)
+        {
+            break;
+        }
+
+        uSys end = ChunkSize;
+        u64 keep = ~0ull;
+
+        // The last sequence continues into the next chunk, stop at its lead byte.
+        if((lead234 >> 63) | (lead34 >> 62) | (lead4 >> 61))
+        {
+            end = 63 - static_cast<uSys>(::std::countl_zero(~continuation));
+            keep = (1ull << end) - 1;
+        }
+
+        const iSys chunkCodePoints = ::std::popcount(~continuation & keep);
+        codePoints += chunkCodePoints;
+        utf16CodeUnits += chunkCodePoints + ::std::popcount(lead4 & keep);
+        i += end;
+    }
+
+    return i;
+}
+
+inline uSys CountUtf16(const u8* const in, const uSys length, iSys& codePoints, iSys& utf8CodeUnits) noexcept
+{
+    constexpr uSys Units = ChunkSize / 2;
+
+    uSys i = 0;
+
+    while(i + Units <= length)
+    {
+        const u8* const p = in + i * 2;
+        const u64 high = ChunkMaskedEqual<u16>(p, 0xFC00, 0xD800);
+        const u64 low = ChunkMaskedEqual<u16>(p, 0xFC00, 0xDC00);
+
+        // Each low surrogate must follow a high surrogate.
+        if((high << 2) != low)
+        {
+            break;
+        }
+
+        uSys end = Units;
+        u64 keep = ~0ull;
+
+        // The last pair continues into the next chunk.
+        if(high >> 62)
+        {
+            end = Units - 1;
+            keep = (1ull << (end * 2)) - 1;
+        }
+
+        const u64 over7F = ~ChunkMaskedEqual<u16>(p, 0xFF80, 0x0000) & keep;
+        const u64 over7FF = ~ChunkMaskedEqual<u16>(p, 0xF800, 0x0000) & keep;
+        const iSys pairs = ::std::popcount(high & keep) / 2;
+
+        // A surrogate counts as 3 bytes, a pair of them is 4.
+        codePoints += static_cast<iSys>(end) - pairs;
+        utf8CodeUnits += static_cast<iSys>(end) + (::std::popcount(over7F) + ::std::popcount(over7FF)) / 2 - pairs * 2;
+        i += end;
+    }
+
+    return i;
+}
+
+inline uSys CountUtf32(const u8* const in, const uSys length, iSys& utf8CodeUnits, iSys& utf16CodeUnits) noexcept
+{
+    constexpr uSys Units = ChunkSize / 4;
+
+    uSys i = 0;
+
+    for(; i + Units <= length; i += Units)
+    {
+        const u8* const p = in + i * 4;
+
+        // Past U+10FFFF is anything over 0x1FFFFF, or 0x110000 through 0x1FFFFF.
+        const u64 over1FFFFF = ~ChunkMaskedEqual<u32>(p, 0xFFE00000, 0x00000000);
+        const u64 plane16Plus = ChunkMaskedEqual<u32>(p, 0x00100000, 0x00100000) & ~ChunkMaskedEqual<u32>(p, 0x000F0000, 0x00000000);
+
+        if(over1FFFFF | plane16Plus)
+        {
+            break;
+        }
+
+        const iSys over7F = ::std::popcount(~ChunkMaskedEqual<u32>(p, 0xFFFFFF80, 0x00000000));
+        const iSys over7FF = ::std::popcount(~ChunkMaskedEqual<u32>(p, 0xFFFFF800, 0x00000000));
+        const iSys overFFFF = ::std::popcount(~ChunkMaskedEqual<u32>(p, 0xFFFF0000, 0x00000000));
+        const iSys surrogates = ::std::popcount(ChunkMaskedEqual<u32>(p, 0xFFFFF800, 0x0000D800));
+
+        utf8CodeUnits += static_cast<iSys>(Units) + (over7F + over7FF + overFFFF) / 4;
+        utf16CodeUnits += static_cast<iSys>(Units) + (overFFFF + surrogates) / 4;
+    }
+
+    return i;
+}
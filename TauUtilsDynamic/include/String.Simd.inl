@@ -0,0 +1,706 @@
+#pragma once
+
+#if defined(STRING_IN_DEV) || 0
+#include "String.hpp"
+#endif
+
+#include "NumTypes.hpp"
+
+#if !defined(TAU_DISABLE_STRING_SIMD) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+  #define TAU_STRING_SIMD_SSE2 1
+
+  #if defined(__AVX2__)
+    #define TAU_STRING_SIMD_AVX2 1
+  #elif defined(_MSC_VER) || defined(__GNUC__) || defined(__clang__)
+    #define TAU_STRING_SIMD_AVX2 1
+    #define TAU_STRING_SIMD_AVX2_DISPATCH 1
+  #endif
+#endif
+
+// The terminator scans read whole vectors past the end of the
+// string, which never crosses into an unmapped page but which
+// AddressSanitizer reports anyway, so they use the scalar loops.
+#if defined(__SANITIZE_ADDRESS__)
+  #define TAU_STRING_SIMD_ASAN 1
+#elif defined(__has_feature)
+  #if __has_feature(address_sanitizer)
+    #define TAU_STRING_SIMD_ASAN 1
+  #endif
+#endif
+
+#pragma warning(push, 0)
+#include <bit>
+#include <type_traits>
+#if defined(TAU_STRING_SIMD_SSE2)
+  #include <emmintrin.h>
+#endif
+#if defined(TAU_STRING_SIMD_AVX2)
+  #include <immintrin.h>
+#endif
+#if defined(TAU_STRING_SIMD_AVX2_DISPATCH) && defined(_MSC_VER)
+  #include <intrin.h>
+#endif
+#pragma warning(pop)
+
+/**
+ *   The code unit primitives the string classes are built on,
+ * length, equality, lexicographic comparison and searching, and
+ * the ASCII fast path of the Unicode transforms.
+ *
+ *   On x86 these process 16 bytes at a time with SSE2, or 32
+ * bytes with AVX2 when the processor supports it, selected at
+ * run time unless the build already targets AVX2. Other targets,
+ * constant evaluation, and builds defining
+ * `TAU_DISABLE_STRING_SIMD` use the scalar versions.
+ *
+ *   Searches return the length of the string they searched when
+ * nothing is found.
+ */
+namespace tau::string::simd {
+
+/**
+ *   The code unit counts classify 64 bytes at a time, so a chunk's
+ * classes fit in a u64 with a bit per byte. When the vector pass
+ * stops the callers count this many code units with their scalar
+ * loops before trying it again.
+ */
+inline constexpr uSys ChunkSize = 64;
+
+namespace scalar {
+
+template<typename Char>
+[[nodiscard]] inline constexpr uSys Length(const Char* const str) noexcept
+{
+    uSys i = 0;
+    // ReSharper disable once CppPossiblyErroneousEmptyStatements
+    for(; str[i]; ++i);
+    return i;
+}
+
+template<typename Char>
+[[nodiscard]] inline constexpr uSys Mismatch(const Char* const lhs, const Char* const rhs, const uSys length) noexcept
+{
+    uSys i = 0;
+    // ReSharper disable once CppPossiblyErroneousEmptyStatements
+    for(; i < length && lhs[i] == rhs[i]; ++i);
+    return i;
+}
+
+template<typename Char>
+[[nodiscard]] inline constexpr uSys Find(const Char* const str, const uSys length, const Char c) noexcept
+{
+    uSys i = 0;
+    // ReSharper disable once CppPossiblyErroneousEmptyStatements
+    for(; i < length && str[i] != c; ++i);
+    return i;
+}
+
+template<typename Char>
+[[nodiscard]] inline constexpr uSys Find(const Char* const str, const uSys length, const Char* const needle, const uSys needleLength) noexcept
+{
+    if(needleLength > length)
+    {
+        return length;
+    }
+
+    for(uSys i = 0; i <= length - needleLength; ++i)
+    {
+        if(Mismatch(str + i, needle, needleLength) == needleLength)
+        {
+            return i;
+        }
+    }
+
+    return length;
+}
+
+template<typename Char>
+[[nodiscard]] inline constexpr i32 Compare(const Char* const lhs, const Char* const rhs) noexcept
+{
+    using UChar = ::std::make_unsigned_t<Char>;
+
+    uSys i = 0;
+    // ReSharper disable once CppPossiblyErroneousEmptyStatements
+    for(; lhs[i] && lhs[i] == rhs[i]; ++i);
+
+    const UChar l = static_cast<UChar>(lhs[i]);
+    const UChar r = static_cast<UChar>(rhs[i]);
+    return l == r ? 0 : (l < r ? -1 : 1);
+}
+
+}
+
+#if defined(TAU_STRING_SIMD_SSE2)
+namespace sse2 {
+
+using Vector = __m128i;
+inline constexpr uSys Width = 16;
+
+[[nodiscard]] inline Vector Load(const void* const p) noexcept
+{ return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+
+[[nodiscard]] inline Vector LoadAligned(const void* const p) noexcept
+{ return _mm_load_si128(static_cast<const __m128i*>(p)); }
+
+[[nodiscard]] inline Vector And(const Vector a, const Vector b) noexcept
+{ return _mm_and_si128(a, b); }
+
+template<typename Char>
+[[nodiscard]] inline Vector Splat(const Char c) noexcept
+{
+    if constexpr(sizeof(Char) == 1) { return _mm_set1_epi8(static_cast<char>(c)); }
+    else if constexpr(sizeof(Char) == 2) { return _mm_set1_epi16(static_cast<short>(c)); }
+    else { return _mm_set1_epi32(static_cast<int>(c)); }
+}
+
+template<typename Char>
+[[nodiscard]] inline u32 EqualMask(const Vector a, const Vector b) noexcept
+{
+    if constexpr(sizeof(Char) == 1) { return static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))); }
+    else if constexpr(sizeof(Char) == 2) { return static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi16(a, b))); }
+    else { return static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi32(a, b))); }
+}
+
+/**
+ *   Loads 16 code units, if they are all ASCII they are packed
+ * into bytes and true is returned.
+ */
+template<typename Char>
+[[nodiscard]] inline bool NarrowAscii(const Char* const in, Vector& bytes) noexcept
+{
+    const u8* const p = reinterpret_cast<const u8*>(in);
+    const Vector zero = _mm_setzero_si128();
+
+    if constexpr(sizeof(Char) == 1)
+    {
+        bytes = Load(p);
+        return _mm_movemask_epi8(bytes) == 0;
+    }
+    else if constexpr(sizeof(Char) == 2)
+    {
+        const Vector a = Load(p);
+        const Vector b = Load(p + 16);
+        const Vector high = _mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi16(static_cast<short>(0xFF80)));
+
+        if(_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xFFFF)
+        { return false; }
+
+        bytes = _mm_packus_epi16(a, b);
+        return true;
+    }
+    else
+    {
+        const Vector a = Load(p);
+        const Vector b = Load(p + 16);
+        const Vector c = Load(p + 32);
+        const Vector d = Load(p + 48);
+        const Vector high = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), _mm_set1_epi32(static_cast<int>(0xFFFFFF80)));
+
+        if(_mm_movemask_epi8(_mm_cmpeq_epi32(high, zero)) != 0xFFFF)
+        { return false; }
+
+        bytes = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        return true;
+    }
+}
+
+/**
+ *   Stores 16 ASCII bytes as code units, flipEndian only applies
+ * to 2 byte code units.
+ */
+template<typename Char>
+inline void WidenAscii(const Vector bytes, Char* const out, const bool flipEndian) noexcept
+{
+    __m128i* const p = reinterpret_cast<__m128i*>(out);
+    const Vector zero = _mm_setzero_si128();
+
+    if constexpr(sizeof(Char) == 1)
+    {
+        _mm_storeu_si128(p, bytes);
+    }
+    else if constexpr(sizeof(Char) == 2)
+    {
+        if(flipEndian)
+        {
+            _mm_storeu_si128(p, _mm_unpacklo_epi8(zero, bytes));
+            _mm_storeu_si128(p + 1, _mm_unpackhi_epi8(zero, bytes));
+        }
+        else
+        {
+            _mm_storeu_si128(p, _mm_unpacklo_epi8(bytes, zero));
+            _mm_storeu_si128(p + 1, _mm_unpackhi_epi8(bytes, zero));
+        }
+    }
+    else
+    {
+        const Vector low = _mm_unpacklo_epi8(bytes, zero);
+        const Vector high = _mm_unpackhi_epi8(bytes, zero);
+        _mm_storeu_si128(p, _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(p + 1, _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(p + 2, _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(p + 3, _mm_unpackhi_epi16(high, zero));
+    }
+}
+
+#include "String.Simd.Kernels.inl"
+
+}
+#endif
+
+#if defined(TAU_STRING_SIMD_AVX2)
+#if defined(TAU_STRING_SIMD_AVX2_DISPATCH)
+  #if defined(__clang__)
+    #pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+  #elif defined(__GNUC__)
+    #pragma GCC push_options
+    #pragma GCC target("avx2")
+  #endif
+#endif
+
+namespace avx2 {
+
+using Vector = __m256i;
+inline constexpr uSys Width = 32;
+
+[[nodiscard]] inline Vector Load(const void* const p) noexcept
+{ return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+
+[[nodiscard]] inline Vector LoadAligned(const void* const p) noexcept
+{ return _mm256_load_si256(static_cast<const __m256i*>(p)); }
+
+[[nodiscard]] inline Vector And(const Vector a, const Vector b) noexcept
+{ return _mm256_and_si256(a, b); }
+
+template<typename Char>
+[[nodiscard]] inline Vector Splat(const Char c) noexcept
+{
+    if constexpr(sizeof(Char) == 1) { return _mm256_set1_epi8(static_cast<char>(c)); }
+    else if constexpr(sizeof(Char) == 2) { return _mm256_set1_epi16(static_cast<short>(c)); }
+    else { return _mm256_set1_epi32(static_cast<int>(c)); }
+}
+
+template<typename Char>
+[[nodiscard]] inline u32 EqualMask(const Vector a, const Vector b) noexcept
+{
+    if constexpr(sizeof(Char) == 1) { return static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b))); }
+    else if constexpr(sizeof(Char) == 2) { return static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(a, b))); }
+    else { return static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(a, b))); }
+}
+
+template<typename Char>
+[[nodiscard]] inline bool NarrowAscii(const Char* const in, Vector& bytes) noexcept
+{
+    const u8* const p = reinterpret_cast<const u8*>(in);
+
+    if constexpr(sizeof(Char) == 1)
+    {
+        bytes = Load(p);
+        return _mm256_movemask_epi8(bytes) == 0;
+    }
+    else if constexpr(sizeof(Char) == 2)
+    {
+        const Vector a = Load(p);
+        const Vector b = Load(p + 32);
+
+        if(!_mm256_testz_si256(_mm256_or_si256(a, b), _mm256_set1_epi16(static_cast<short>(0xFF80))))
+        { return false; }
+
+        // Packing works within 128 bit lanes, put the 64 bit blocks back in order.
+        bytes = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8);
+        return true;
+    }
+    else
+    {
+        const Vector a = Load(p);
+        const Vector b = Load(p + 32);
+        const Vector c = Load(p + 64);
+        const Vector d = Load(p + 96);
+
+        if(!_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d)), _mm256_set1_epi32(static_cast<int>(0xFFFFFF80))))
+        { return false; }
+
+        const Vector packed = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+        bytes = _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+        return true;
+    }
+}
+
+template<typename Char>
+inline void WidenAscii(const Vector bytes, Char* const out, const bool flipEndian) noexcept
+{
+    __m256i* const p = reinterpret_cast<__m256i*>(out);
+    const __m128i low = _mm256_castsi256_si128(bytes);
+    const __m128i high = _mm256_extracti128_si256(bytes, 1);
+
+    if constexpr(sizeof(Char) == 1)
+    {
+        _mm256_storeu_si256(p, bytes);
+    }
+    else if constexpr(sizeof(Char) == 2)
+    {
+        const Vector first = _mm256_cvtepu8_epi16(low);
+        const Vector second = _mm256_cvtepu8_epi16(high);
+
+        if(flipEndian)
+        {
+            _mm256_storeu_si256(p, _mm256_slli_epi16(first, 8));
+            _mm256_storeu_si256(p + 1, _mm256_slli_epi16(second, 8));
+        }
+        else
+        {
+            _mm256_storeu_si256(p, first);
+            _mm256_storeu_si256(p + 1, second);
+        }
+    }
+    else
+    {
+        _mm256_storeu_si256(p, _mm256_cvtepu8_epi32(low));
+        _mm256_storeu_si256(p + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+        _mm256_storeu_si256(p + 2, _mm256_cvtepu8_epi32(high));
+        _mm256_storeu_si256(p + 3, _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+    }
+}
+
+#include "String.Simd.Kernels.inl"
+
+}
+
+#if defined(TAU_STRING_SIMD_AVX2_DISPATCH)
+  #if defined(__clang__)
+    #pragma clang attribute pop
+  #elif defined(__GNUC__)
+    #pragma GCC pop_options
+  #endif
+#endif
+#endif
+
+#if defined(TAU_STRING_SIMD_AVX2_DISPATCH)
+[[nodiscard]] inline bool DetectAvx2() noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+
+    if(info[0] < 7)
+    {
+        return false;
+    }
+
+    __cpuid(info, 1);
+
+    // The OS must save the AVX registers.
+    if(!(info[2] & (1 << 27)) || !(info[2] & (1 << 28)) || (_xgetbv(0) & 6) != 6)
+    {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+/**
+ *   Whether to use the AVX2 kernels. Strings used during static
+ * initialization, before this is set, use SSE2.
+ */
+inline const bool UseAvx2 = DetectAvx2();
+#endif
+
+template<typename Char>
+[[nodiscard]] inline constexpr uSys Length(const Char* const str) noexcept
+{
+    if(::std::is_constant_evaluated())
+    {
+        return scalar::Length(str);
+    }
+
+#if defined(TAU_STRING_SIMD_ASAN)
+    return scalar::Length(str);
+#elif defined(TAU_STRING_SIMD_AVX2_DISPATCH)
+    if(UseAvx2) { return avx2::Length(str); }
+    return sse2::Length(str);
+#elif defined(TAU_STRING_SIMD_AVX2)
+    return avx2::Length(str);
+#elif defined(TAU_STRING_SIMD_SSE2)
+    return sse2::Length(str);
+#else
+    return scalar::Length(str);
+#endif
+}
+
+/**
+ * The index of the first code unit that differs, or length if they are equal.
+ */
+template<typename Char>
+[[nodiscard]] inline constexpr uSys Mismatch(const Char* const lhs, const Char* const rhs, const uSys length) noexcept
+{
+    if(::std::is_constant_evaluated())
+    {
+        return scalar::Mismatch(lhs, rhs, length);
+    }
+
+#if defined(TAU_STRING_SIMD_AVX2_DISPATCH)
+    if(UseAvx2) { return avx2::Mismatch(lhs, rhs, length); }
+    return sse2::Mismatch(lhs, rhs, length);
+#elif defined(TAU_STRING_SIMD_AVX2)
+    return avx2::Mismatch(lhs, rhs, length);
+#elif defined(TAU_STRING_SIMD_SSE2)
+    return sse2::Mismatch(lhs, rhs, length);
+#else
+    return scalar::Mismatch(lhs, rhs, length);
+#endif
+}
+
+template<typename Char>
+[[nodiscard]] inline constexpr bool Equal(const Char* const lhs, const Char* const rhs, const uSys length) noexcept
+{
+    if(lhs == rhs)
+    {
+        return true;
+    }
+
+    return Mismatch(lhs, rhs, length) == length;
+}
+
+/**
+ *   Compares two strings lexicographically by the unsigned value
+ * of their code units, a prefix compares less than the longer
+ * string. Returns -1, 0, or 1.
+ */
+template<typename Char>
+[[nodiscard]] inline constexpr i32 Compare(const Char* const lhs, const uSys lhsLength, const Char* const rhs, const uSys rhsLength) noexcept
+{
+    using UChar = ::std::make_unsigned_t<Char>;
+
+    const uSys length = lhsLength < rhsLength ? lhsLength : rhsLength;
+    const uSys index = lhs == rhs ? length : Mismatch(lhs, rhs, length);
+
+    if(index == length)
+    {
+        return lhsLength == rhsLength ? 0 : (lhsLength < rhsLength ? -1 : 1);
+    }
+
+    return static_cast<UChar>(lhs[index]) < static_cast<UChar>(rhs[index]) ? -1 : 1;
+}
+
+/**
+ *   Compares two null terminated strings in a single pass,
+ * stopping at the first difference or terminator rather than
+ * measuring both strings first.
+ */
+template<typename Char>
+[[nodiscard]] inline constexpr i32 Compare(const Char* const lhs, const Char* const rhs) noexcept
+{
+    if(lhs == rhs)
+    {
+        return 0;
+    }
+
+    if(::std::is_constant_evaluated())
+    {
+        return scalar::Compare(lhs, rhs);
+    }
+
+#if defined(TAU_STRING_SIMD_ASAN)
+    return scalar::Compare(lhs, rhs);
+#elif defined(TAU_STRING_SIMD_AVX2_DISPATCH)
+    if(UseAvx2) { return avx2::Compare(lhs, rhs); }
+    return sse2::Compare(lhs, rhs);
+#elif defined(TAU_STRING_SIMD_AVX2)
+    return avx2::Compare(lhs, rhs);
+#elif defined(TAU_STRING_SIMD_SSE2)
+    return sse2::Compare(lhs, rhs);
+#else
+    return scalar::Compare(lhs, rhs);
+#endif
+}
+
+/**
+ * The index of the first c in str, or length if there is none.
+ */
+template<typename Char>
+[[nodiscard]] inline constexpr uSys Find(const Char* const str, const uSys length, const Char c) noexcept
+{
+    if(::std::is_constant_evaluated())
+    {
+        return scalar::Find(str, length, c);
+    }
+
+#if defined(TAU_STRING_SIMD_AVX2_DISPATCH)
+    if(UseAvx2) { return avx2::Find(str, length, c); }
+    return sse2::Find(str, length, c);
+#elif defined(TAU_STRING_SIMD_AVX2)
+    return avx2::Find(str, length, c);
+#elif defined(TAU_STRING_SIMD_SSE2)
+    return sse2::Find(str, length, c);
+#else
+    return scalar::Find(str, length, c);
+#endif
+}
+
+/**
+ *   The index of the first occurrence of needle in str, or length
+ * if there is none. An empty needle is found at 0.
+ */
+template<typename Char>
+[[nodiscard]] inline constexpr uSys Find(const Char* const str, const uSys length, const Char* const needle, const uSys needleLength) noexcept
+{
+    if(::std::is_constant_evaluated())
+    {
+        return scalar::Find(str, length, needle, needleLength);
+    }
+
+#if defined(TAU_STRING_SIMD_AVX2_DISPATCH)
+    if(UseAvx2) { return avx2::Find(str, length, needle, needleLength); }
+    return sse2::Find(str, length, needle, needleLength);
+#elif defined(TAU_STRING_SIMD_AVX2)
+    return avx2::Find(str, length, needle, needleLength);
+#elif defined(TAU_STRING_SIMD_SSE2)
+    return sse2::Find(str, length, needle, needleLength);
+#else
+    return scalar::Find(str, length, needle, needleLength);
+#endif
+}
+
+/**
+ *   Copies the leading ASCII of in to out a vector at a time,
+ * converting between code unit sizes, and returns the number of
+ * code units copied. This stops at the first vector containing a
+ * non ASCII code unit, or when either string runs out, leaving
+ * the rest to the caller's scalar loop.
+ *
+ *   flipEndian byte swaps 2 byte code units being written.
+ */
+template<typename CharIn, typename CharOut>
+[[nodiscard]] inline constexpr iSys TranscodeAscii(const CharIn* const in, CharOut* const out, const iSys inCodeUnits, const iSys outCodeUnits, const bool flipEndian = false) noexcept
+{
+    using UCharIn = ::std::make_unsigned_t<CharIn>;
+
+    const iSys length = inCodeUnits < outCodeUnits ? inCodeUnits : outCodeUnits;
+
+    // Don't bother loading a vector when the next code unit isn't ASCII.
+    if(::std::is_constant_evaluated() || length <= 0 || static_cast<UCharIn>(in[0]) >= 0x80)
+    {
+        return 0;
+    }
+
+#if defined(TAU_STRING_SIMD_AVX2_DISPATCH)
+    if(UseAvx2) { return static_cast<iSys>(avx2::TranscodeAscii(in, out, static_cast<uSys>(length), flipEndian)); }
+    return static_cast<iSys>(sse2::TranscodeAscii(in, out, static_cast<uSys>(length), flipEndian));
+#elif defined(TAU_STRING_SIMD_AVX2)
+    return static_cast<iSys>(avx2::TranscodeAscii(in, out, static_cast<uSys>(length), flipEndian));
+#elif defined(TAU_STRING_SIMD_SSE2)
+    return static_cast<iSys>(sse2::TranscodeAscii(in, out, static_cast<uSys>(length), flipEndian));
+#else
+    (void) in;
+    (void) out;
+    (void) flipEndian;
+    return 0;
+#endif
+}
+
+/**
+ *   Counts structurally valid UTF-8 a chunk at a time, adding its
+ * code points, and its length in UTF-16 code units. Returns the
+ * number of code units counted, which always ends on a code point
+ * boundary.
+ *
+ *   This stops at the first chunk containing a byte which can't
+ * start a sequence, or a continuation byte which doesn't belong
+ * to the preceding lead byte, leaving it to the scalar loop.
+ */
+template<typename Char>
+[[nodiscard]] inline constexpr iSys CountUtf8(const Char* const in, const iSys inCodeUnits, iSys& codePoints, iSys& utf16CodeUnits) noexcept
+{
+    static_assert(sizeof(Char) == 1);
+
+    if(::std::is_constant_evaluated() || inCodeUnits < static_cast<iSys>(ChunkSize))
+    {
+        return 0;
+    }
+
+    const u8* const bytes = reinterpret_cast<const u8*>(in);
+
+#if defined(TAU_STRING_SIMD_AVX2_DISPATCH)
+    if(UseAvx2) { return static_cast<iSys>(avx2::CountUtf8(bytes, static_cast<uSys>(inCodeUnits), codePoints, utf16CodeUnits)); }
+    return static_cast<iSys>(sse2::CountUtf8(bytes, static_cast<uSys>(inCodeUnits), codePoints, utf16CodeUnits));
+#elif defined(TAU_STRING_SIMD_AVX2)
+    return static_cast<iSys>(avx2::CountUtf8(bytes, static_cast<uSys>(inCodeUnits), codePoints, utf16CodeUnits));
+#elif defined(TAU_STRING_SIMD_SSE2)
+    return static_cast<iSys>(sse2::CountUtf8(bytes, static_cast<uSys>(inCodeUnits), codePoints, utf16CodeUnits));
+#else
+    (void) bytes;
+    (void) codePoints;
+    (void) utf16CodeUnits;
+    return 0;
+#endif
+}
+
+/**
+ *   Counts little endian UTF-16 with well formed surrogate pairs
+ * a chunk at a time, adding its code points, and its length in
+ * UTF-8 code units. Stops at the first chunk with an unpaired
+ * surrogate.
+ */
+template<typename Char>
+[[nodiscard]] inline constexpr iSys CountUtf16(const Char* const in, const iSys inCodeUnits, iSys& codePoints, iSys& utf8CodeUnits) noexcept
+{
+    static_assert(sizeof(Char) == 2);
+
+    if(::std::is_constant_evaluated() || inCodeUnits < static_cast<iSys>(ChunkSize / 2))
+    {
+        return 0;
+    }
+
+    const u8* const bytes = reinterpret_cast<const u8*>(in);
+
+#if defined(TAU_STRING_SIMD_AVX2_DISPATCH)
+    if(UseAvx2) { return static_cast<iSys>(avx2::CountUtf16(bytes, static_cast<uSys>(inCodeUnits), codePoints, utf8CodeUnits)); }
+    return static_cast<iSys>(sse2::CountUtf16(bytes, static_cast<uSys>(inCodeUnits), codePoints, utf8CodeUnits));
+#elif defined(TAU_STRING_SIMD_AVX2)
+    return static_cast<iSys>(avx2::CountUtf16(bytes, static_cast<uSys>(inCodeUnits), codePoints, utf8CodeUnits));
+#elif defined(TAU_STRING_SIMD_SSE2)
+    return static_cast<iSys>(sse2::CountUtf16(bytes, static_cast<uSys>(inCodeUnits), codePoints, utf8CodeUnits));
+#else
+    (void) bytes;
+    (void) codePoints;
+    (void) utf8CodeUnits;
+    return 0;
+#endif
+}
+
+/**
+ *   Counts the UTF-8 and UTF-16 lengths of UTF-32 a chunk at a
+ * time. Stops at the first chunk with a value past U+10FFFF.
+ */
+template<typename Char>
+[[nodiscard]] inline constexpr iSys CountUtf32(const Char* const in, const iSys inCodeUnits, iSys& utf8CodeUnits, iSys& utf16CodeUnits) noexcept
+{
+    static_assert(sizeof(Char) == 4);
+
+    if(::std::is_constant_evaluated() || inCodeUnits < static_cast<iSys>(ChunkSize / 4))
+    {
+        return 0;
+    }
+
+    const u8* const bytes = reinterpret_cast<const u8*>(in);
+
+#if defined(TAU_STRING_SIMD_AVX2_DISPATCH)
+    if(UseAvx2) { return static_cast<iSys>(avx2::CountUtf32(bytes, static_cast<uSys>(inCodeUnits), utf8CodeUnits, utf16CodeUnits)); }
+    return static_cast<iSys>(sse2::CountUtf32(bytes, static_cast<uSys>(inCodeUnits), utf8CodeUnits, utf16CodeUnits));
+#elif defined(TAU_STRING_SIMD_AVX2)
+    return static_cast<iSys>(avx2::CountUtf32(bytes, static_cast<uSys>(inCodeUnits), utf8CodeUnits, utf16CodeUnits));
+#elif defined(TAU_STRING_SIMD_SSE2)
+    return static_cast<iSys>(sse2::CountUtf32(bytes, static_cast<uSys>(inCodeUnits), utf8CodeUnits, utf16CodeUnits));
+#else
+    (void) bytes;
+    (void) utf8CodeUnits;
+    (void) utf16CodeUnits;
+    return 0;
+#endif
+}
+
+}
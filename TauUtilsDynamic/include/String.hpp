@@ -68,6 +68,9 @@ case C32ConstExprString(CASE).HashCode(): \
     } \
     break;
 
+#include "String.Hash.inl"
+#include "String.Simd.inl"
+
 namespace tau::string {
 
 template<typename Char>
@@ -240,6 +243,11 @@ class StringBaseT
     DEFAULT_CONSTRUCT_PO(StringBaseT);
     DEFAULT_DESTRUCT_VI(StringBaseT);
     DEFAULT_CM_PO(StringBaseT);
+public:
+    /**
+     * Returned by `IndexOf` when nothing is found.
+     */
+    static constexpr uSys NotFound = static_cast<uSys>(-1);
 public:
     [[nodiscard]] NONNULL virtual const Char* String() const noexcept = 0;
     [[nodiscard]] virtual uSys Length() const noexcept = 0;
@@ -543,7 +551,7 @@ public:
     }
 private:
     tau::string::StringData<Char> m_Data;
-    uSys m_Hash;
+    tau::string::StringHashCache m_Hash;
 private:
     template<uSys Len>
     constexpr DynStringT(const Char (&str)[Len]) noexcept;
@@ -566,7 +574,7 @@ public:
 
     [[nodiscard]] NONNULL constexpr const Char* String() const noexcept override { return m_Data.String(); }
     [[nodiscard]] constexpr uSys Length() const noexcept override { return m_Data.Length; }
-    [[nodiscard]] constexpr uSys HashCode() const noexcept override { return m_Hash; }
+    [[nodiscard]] constexpr uSys HashCode() const noexcept override { return m_Hash.Get(m_Data.String(), m_Data.Length); }
     
     [[nodiscard]] constexpr bool Equals(const StringBaseT<Char>& other) const noexcept override;
     [[nodiscard]] constexpr bool Equals(const ConstExprStringT<Char>& other) const noexcept override;
@@ -604,6 +612,10 @@ public:
     [[nodiscard]] constexpr DynStringT<Char> SubStringLen(INCLUSIVE uSys begin, uSys length) const noexcept;
     [[nodiscard]] constexpr DynStringT<Char> SubString(INCLUSIVE uSys begin, EXCLUSIVE uSys end) const noexcept;
     [[nodiscard]] constexpr DynStringT<Char> SubString(INCLUSIVE uSys from) const noexcept;
+
+    [[nodiscard]] constexpr uSys IndexOf(Char c, uSys from = 0) const noexcept;
+    [[nodiscard]] constexpr uSys IndexOf(const StringBaseT<Char>& str, uSys from = 0) const noexcept;
+    [[nodiscard]] constexpr uSys IndexOf(const Char* str, uSys from = 0) const noexcept;
     
     [[nodiscard]] constexpr Char operator [](uSys index) const noexcept;
     [[nodiscard]] constexpr Char At(uSys index) const noexcept;
@@ -632,7 +644,7 @@ private:
     tau::string::StringData<Char> m_Data;
     uSys m_Start;
     uSys m_Length;
-    uSys m_Hash;
+    tau::string::StringHashCache m_Hash;
 private:
     constexpr DynStringViewT(uSys begin, uSys length, const DynStringT<Char>& str) noexcept;
     constexpr DynStringViewT(uSys begin, uSys length, const DynStringViewT<Char>& str) noexcept;
@@ -660,7 +672,7 @@ public:
 
     [[nodiscard]] constexpr const Char* String() const noexcept override { return m_Data.String() + m_Start; }
     [[nodiscard]] constexpr uSys Length() const noexcept override { return m_Length; }
-    [[nodiscard]] constexpr uSys HashCode() const noexcept override { return m_Hash; }
+    [[nodiscard]] constexpr uSys HashCode() const noexcept override { return m_Hash.Get(m_Data.String() + m_Start, m_Length); }
     
     [[nodiscard]] constexpr DynStringCodePointIteratorT<Char> Begin() const noexcept { return DynStringCodePointIteratorT<Char>(m_Data, m_Start); }
     [[nodiscard]] constexpr DynStringCodePointIteratorT<Char>   End() const noexcept { return DynStringCodePointIteratorT<Char>(m_Data, m_Data.Length); }
@@ -698,6 +710,10 @@ public:
     [[nodiscard]] inline constexpr DynStringT<Char> SubStringLen(INCLUSIVE uSys begin, uSys length) const noexcept;
     [[nodiscard]] inline constexpr DynStringT<Char> SubString(INCLUSIVE uSys begin, EXCLUSIVE uSys end) const noexcept;
     [[nodiscard]] inline constexpr DynStringT<Char> SubString(INCLUSIVE uSys from) const noexcept;
+
+    [[nodiscard]] inline constexpr uSys IndexOf(Char c, uSys from = 0) const noexcept;
+    [[nodiscard]] inline constexpr uSys IndexOf(const StringBaseT<Char>& str, uSys from = 0) const noexcept;
+    [[nodiscard]] inline constexpr uSys IndexOf(const Char* str, uSys from = 0) const noexcept;
     
     [[nodiscard]] inline constexpr Char operator [](uSys index) const noexcept;
     [[nodiscard]] inline constexpr Char At(uSys index) const noexcept;
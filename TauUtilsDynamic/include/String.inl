@@ -443,23 +443,13 @@ inline uSys toUpper(const C* const str, C* const store) noexcept
 template<typename C>
 inline constexpr uSys findHashCode(const C* str) noexcept
 {
-    uSys hash = 0;
-    for(uSys i = 0; str[i]; ++i)
-    {
-        hash = 31u * hash + static_cast<uSys>(str[i]);
-    }
-    return hash;
+    return ::tau::string::hash::HashString(str, strLength(str));
 }
 
 template<typename C>
 inline constexpr uSys findHashCode(const C* str, const uSys len) noexcept
 {
-    uSys hash = 0;
-    for(uSys i = 0; i < len; ++i)
-    {
-        hash = 31u * hash + static_cast<uSys>(str[i]);
-    }
-    return hash;
+    return ::tau::string::hash::HashString(str, len);
 }
 
 template<typename Char>
@@ -477,7 +467,10 @@ inline constexpr uSys strLengthConst(const Char* const str) noexcept
 template<typename Char>
 inline constexpr uSys strLength(const Char* const str) noexcept
 {
-    return strLengthConst(str);
+    if(!str)
+    { return 0; }
+
+    return ::tau::string::simd::Length(str);
 }
 
 template<>
@@ -543,7 +536,7 @@ inline constexpr i32 strCompareConst(const C* lhs, const C* rhs) noexcept
 template<typename C>
 inline constexpr i32 strCompare(const C* lhs, const C* rhs) noexcept
 {
-    return strCompareConst(lhs, rhs);
+    return ::tau::string::simd::Compare(lhs, rhs);
 }
 
 template<>
@@ -594,7 +587,7 @@ inline constexpr i32 strCompareConst(const C* lhs, const C* rhs, const uSys leng
         ++i;
     }
 
-    if(*lhs == *rhs)
+    if(i == length || *lhs == *rhs)
     {
         return 0;
     }
@@ -675,12 +668,7 @@ inline constexpr bool cexpr::streqIgnoreCase(const Char(&lhs)[Len], const Char(&
 template<typename Char, uSys Len>
 inline constexpr uSys cexpr::findHashCode(const Char(&str)[Len]) noexcept
 {
-    uSys hash = 0;
-    for(uSys i = 0; str[i]; ++i)
-    {
-        hash = 31u * hash + static_cast<uSys>(str[i]);
-    }
-    return hash;
+    return ::tau::string::hash::HashString(str, strLength(str));
 }
 
 template<typename Char>
@@ -896,7 +884,7 @@ inline constexpr bool ConstExprStringT<Char>::Equals(const StringBaseT<Char>& ot
     if(this == &other) { return true; }
     if(m_String == other.String()) { return true; }
     if(m_Length != other.Length()) { return false; }
-    if(m_Hash != other.HashCode()) { return false; }
+    if(!::tau::string::StringHashCache::IsLazy && m_Hash != other.HashCode()) { return false; }
     return strCompare(m_String, other.String()) == 0;
 }
 
@@ -912,7 +900,7 @@ inline constexpr bool ConstExprStringT<Char>::Equals(const ConstExprStringT<Char
 template<typename Char>
 inline constexpr bool ConstExprStringT<Char>::Equals(const DynStringT<Char>& other) const noexcept
 {
-    if(m_Length != other.Length() || m_Hash != other.HashCode())
+    if(m_Length != other.Length() || ::tau::string::StringHashCache::Differ(m_Hash, other.m_Hash.Peek()))
     { return false; }
     return strCompare(m_String, other.String()) == 0;
 }
@@ -920,7 +908,7 @@ inline constexpr bool ConstExprStringT<Char>::Equals(const DynStringT<Char>& oth
 template<typename Char>
 inline constexpr bool ConstExprStringT<Char>::Equals(const DynStringViewT<Char>& other) const noexcept
 {
-    if(m_Length != other.Length() || m_Hash != other.HashCode())
+    if(m_Length != other.Length() || ::tau::string::StringHashCache::Differ(m_Hash, other.m_Hash.Peek()))
     { return false; }
     return strCompare(m_String, other.String(), m_Length) == 0;
 }
@@ -1127,37 +1115,37 @@ template<typename Char>
 template<uSys Len>
 constexpr DynStringT<Char>::DynStringT(const Char(& str)[Len]) noexcept
     : m_Data(str)
-    , m_Hash(cexpr::findHashCode(str))
+    , m_Hash(str, Len - 1)
 { }
 
 template<typename Char>
 inline constexpr DynStringT<Char>::DynStringT(const Char* const string, const uSys length) noexcept
     : m_Data(string, length)
-    , m_Hash(findHashCode(string))
+    , m_Hash(string, length)
 { }
 
 template<typename Char>
 constexpr DynStringT<Char>::DynStringT(ReferenceCounter::Type* const refCount, const Char* const string, const uSys length) noexcept
     : m_Data(refCount, string, length)
-    , m_Hash(findHashCode(string))
+    , m_Hash(string, length)
 { }
 
 template<typename Char>
 inline constexpr DynStringT<Char>::DynStringT() noexcept
     : m_Data()
-    , m_Hash(0)
+    , m_Hash(static_cast<const Char*>(nullptr), 0)
 { }
 
 template<typename Char>
 inline constexpr DynStringT<Char>::DynStringT(const Char* const string) noexcept
     : m_Data(string, strLength(string))
-    , m_Hash(findHashCode(string))
+    , m_Hash(string, m_Data.Length)
 { }
 
 template<typename Char>
 inline constexpr DynStringT<Char>::DynStringT(const uSys length, const Char* string) noexcept
     : m_Data(string, length)
-    , m_Hash(findHashCode(string, length))
+    , m_Hash(string, length)
 { }
 
 template<typename Char>
@@ -1169,13 +1157,13 @@ inline constexpr DynStringT<Char>::DynStringT(const ConstExprStringT<Char>& stri
 template<typename Char>
 inline constexpr DynStringT<Char>::DynStringT(const DynStringViewT<Char>& string) noexcept
     : m_Data(string.String(), string.Length())
-    , m_Hash(string.HashCode())
+    , m_Hash(string.m_Hash.Peek())
 { }
 
 template<typename Char>
 inline constexpr DynStringT<Char>::DynStringT(const StringBaseT<Char>&string) noexcept
     : m_Data(string.String(), string.Length())
-    , m_Hash(string.HashCode())
+    , m_Hash(::tau::string::StringHashCache::IsLazy ? ::tau::string::StringHashCache(string.String(), string.Length()) : ::tau::string::StringHashCache(string.HashCode()))
 { }
 
 template<typename Char>
@@ -1194,7 +1182,7 @@ inline constexpr DynStringT<Char>& DynStringT<Char>::operator=(const Char* const
     const uSys length = strLength(string);
 
     m_Data.Reset(string, length);
-    m_Hash = findHashCode(string);
+    m_Hash = ::tau::string::StringHashCache(string, length);
     
     return *this;
 }
@@ -1203,7 +1191,7 @@ template<typename Char>
 inline constexpr DynStringT<Char>& DynStringT<Char>::operator=(const ConstExprStringT<Char>& string) noexcept
 {
     m_Data.Reset(string, string.Length());
-    m_Hash = string.HashCode();
+    m_Hash = ::tau::string::StringHashCache(string.HashCode());
 
     return *this;
 }
@@ -1212,7 +1200,7 @@ template<typename Char>
 inline constexpr DynStringT<Char>& DynStringT<Char>::operator=(const DynStringViewT<Char>& string) noexcept
 {
     m_Data.Reset(string, string.Length());
-    m_Hash = string.HashCode();
+    m_Hash = string.m_Hash;
 
     return *this;
 }
@@ -1221,7 +1209,7 @@ template<typename Char>
 inline constexpr DynStringT<Char>& DynStringT<Char>::operator=(const StringBaseT<Char>& string) noexcept
 {
     m_Data.Reset(string, string.Length());
-    m_Hash = string.HashCode();
+    m_Hash = ::tau::string::StringHashCache::IsLazy ? ::tau::string::StringHashCache(string.String(), string.Length()) : ::tau::string::StringHashCache(string.HashCode());
 
     return *this;
 }
@@ -1231,30 +1219,26 @@ inline constexpr bool DynStringT<Char>::Equals(const StringBaseT<Char>& other) c
 {
     if(this == &other) { return true; }
     if(m_Data.Length != other.Length()) { return false; }
-    if(m_Hash != other.HashCode()) { return false; }
-    return strCompare(m_Data.String(), other.String(), m_Data.Length) == 0;
+    // Don't force a lazy hash on either string just to compare them.
+    if(!::tau::string::StringHashCache::IsLazy && m_Hash.Peek() != other.HashCode()) { return false; }
+    return ::tau::string::simd::Equal(m_Data.String(), other.String(), m_Data.Length);
 }
 
 template<typename Char>
 inline constexpr bool DynStringT<Char>::Equals(const ConstExprStringT<Char>& other) const noexcept
 {
     if(m_Data.Length != other.Length()) { return false; }
-    if(m_Hash != other.HashCode()) { return false; }
-    return strCompare(String(), other.String()) == 0;
+    if(::tau::string::StringHashCache::Differ(m_Hash.Peek(), other.HashCode())) { return false; }
+    return ::tau::string::simd::Equal(String(), other.String(), m_Data.Length);
 }
 
 template<typename Char>
 inline constexpr bool DynStringT<Char>::Equals(const DynStringT<Char>& other) const noexcept
 {
     if(this == &other) { return true; }
-    if(m_Data.Length == other.m_Data.Length && m_Hash == other.m_Hash)
+    if(m_Data.Length == other.m_Data.Length && !::tau::string::StringHashCache::Differ(m_Hash.Peek(), other.m_Hash.Peek()))
     {
-        if(m_Data.Length >= 16 && m_Data.String() == other.m_Data.String())
-        {
-            return true;
-        }
-
-        return strCompare(m_Data.String(), other.m_Data.String()) == 0;
+        return ::tau::string::simd::Equal(m_Data.String(), other.m_Data.String(), m_Data.Length);
     }
     return false;
 }
@@ -1263,8 +1247,8 @@ template<typename Char>
 inline constexpr bool DynStringT<Char>::Equals(const DynStringViewT<Char>& other) const noexcept
 {
     if(m_Data.Length != other.Length() ) { return false; }
-    if(m_Hash != other.HashCode()) { return false; }
-    return strCompare(m_Data.String(), other.String(), m_Data.Length) == 0;
+    if(::tau::string::StringHashCache::Differ(m_Hash.Peek(), other.m_Hash.Peek())) { return false; }
+    return ::tau::string::simd::Equal(m_Data.String(), other.String(), m_Data.Length);
 }
 
 template<typename Char>
@@ -1273,19 +1257,19 @@ inline constexpr bool DynStringT<Char>::Equals(const Char* const str) const noex
 
 template<typename Char>
 inline constexpr i32 DynStringT<Char>::CompareTo(const StringBaseT<Char>& other) const noexcept
-{ return strCompare(String(), other.String()); }
+{ return ::tau::string::simd::Compare(String(), m_Data.Length, other.String(), other.Length()); }
 
 template<typename Char>
 inline constexpr i32 DynStringT<Char>::CompareTo(const ConstExprStringT<Char>& other) const noexcept
-{ return strCompare(String(), other.String()); }
+{ return ::tau::string::simd::Compare(String(), m_Data.Length, other.String(), other.Length()); }
 
 template<typename Char>
 inline constexpr i32 DynStringT<Char>::CompareTo(const DynStringT<Char>& other) const noexcept
-{ return strCompare(String(), other.String()); }
+{ return ::tau::string::simd::Compare(String(), m_Data.Length, other.String(), other.Length()); }
 
 template<typename Char>
 inline constexpr i32 DynStringT<Char>::CompareTo(const DynStringViewT<Char>& other) const noexcept
-{ return strCompare(String(), other.String(), other.Length()); }
+{ return ::tau::string::simd::Compare(String(), m_Data.Length, other.String(), other.Length()); }
 
 template<typename Char>
 inline constexpr i32 DynStringT<Char>::CompareTo(const Char* const str) const noexcept
@@ -1370,6 +1354,37 @@ inline constexpr DynStringT<Char> DynStringT<Char>::SubString(const uSys from) c
     return SubStringLen(from, Length() - from);
 }
 
+template<typename Char>
+inline constexpr uSys DynStringT<Char>::IndexOf(const Char c, const uSys from) const noexcept
+{
+    if(from >= m_Data.Length) { return StringBaseT<Char>::NotFound; }
+
+    const uSys remaining = m_Data.Length - from;
+    const uSys index = ::tau::string::simd::Find(String() + from, remaining, c);
+    return index == remaining ? StringBaseT<Char>::NotFound : from + index;
+}
+
+template<typename Char>
+inline constexpr uSys DynStringT<Char>::IndexOf(const StringBaseT<Char>& str, const uSys from) const noexcept
+{
+    if(from > m_Data.Length) { return StringBaseT<Char>::NotFound; }
+
+    const uSys remaining = m_Data.Length - from;
+    const uSys index = ::tau::string::simd::Find(String() + from, remaining, str.String(), str.Length());
+    return index == remaining && str.Length() != 0 ? StringBaseT<Char>::NotFound : from + index;
+}
+
+template<typename Char>
+inline constexpr uSys DynStringT<Char>::IndexOf(const Char* const str, const uSys from) const noexcept
+{
+    if(from > m_Data.Length) { return StringBaseT<Char>::NotFound; }
+
+    const uSys length = strLength(str);
+    const uSys remaining = m_Data.Length - from;
+    const uSys index = ::tau::string::simd::Find(String() + from, remaining, str, length);
+    return index == remaining && length != 0 ? StringBaseT<Char>::NotFound : from + index;
+}
+
 template<typename Char>
 inline constexpr Char DynStringT<Char>::operator[](const uSys index) const noexcept
 { return String()[index]; }
@@ -1386,7 +1401,7 @@ inline constexpr DynStringViewT<Char>::DynStringViewT(const uSys begin, const uS
     : m_Data(str.m_Data)
     , m_Start(begin)
     , m_Length(length)
-    , m_Hash(findHashCode(m_Data.String() + begin, length))
+    , m_Hash(m_Data.String() + begin, length)
 { }
 
 template<typename Char>
@@ -1394,7 +1409,7 @@ inline constexpr DynStringViewT<Char>::DynStringViewT(const uSys begin, const uS
     : m_Data(str.m_Data)
     , m_Start(begin)
     , m_Length(length)
-    , m_Hash(findHashCode(m_Data.String() + begin, length))
+    , m_Hash(m_Data.String() + begin, length)
 { }
 
 template<typename Char>
@@ -1402,7 +1417,7 @@ inline constexpr DynStringViewT<Char>::DynStringViewT(const DynStringT<Char>& st
     : m_Data(str.m_Data)
     , m_Start(begin)
     , m_Length(end - begin)
-    , m_Hash(findHashCode(m_Data.String() + begin, m_Length))
+    , m_Hash(m_Data.String() + begin, m_Length)
 { }
 
 template<typename Char>
@@ -1410,7 +1425,7 @@ inline constexpr DynStringViewT<Char>::DynStringViewT(const DynStringViewT<Char>
     : m_Data(str.m_Data)
     , m_Start(begin)
     , m_Length(end - begin)
-    , m_Hash(findHashCode(m_Data.String() + begin, m_Length))
+    , m_Hash(m_Data.String() + begin, m_Length)
 { }
 
 template<typename Char>
@@ -1418,7 +1433,7 @@ inline constexpr DynStringViewT<Char>::DynStringViewT(const DynStringT<Char>& st
     : m_Data(str.m_Data)
     , m_Start(0)
     , m_Length(str.Length())
-    , m_Hash(str.HashCode())
+    , m_Hash(str.m_Hash)
 { }
 
 template<typename Char>
@@ -1438,7 +1453,7 @@ inline constexpr DynStringViewT<Char>& DynStringViewT<Char>::Reset(const DynStri
     m_Data = str.m_Data;
     m_Start = begin;
     m_Length = end - begin;
-    m_Hash = findHashCode(m_Data.String() + begin, m_Length);
+    m_Hash = ::tau::string::StringHashCache(m_Data.String() + begin, m_Length);
 
     return *this;
 }
@@ -1452,7 +1467,7 @@ inline constexpr DynStringViewT<Char>& DynStringViewT<Char>::ResetLen(const DynS
     m_Data = str.m_Data;
     m_Start = begin;
     m_Length = length;
-    m_Hash = findHashCode(m_Data.String() + begin, length);
+    m_Hash = ::tau::string::StringHashCache(m_Data.String() + begin, length);
 
     return *this;
 }
@@ -1462,9 +1477,9 @@ inline constexpr bool DynStringViewT<Char>::Equals(const StringBaseT<Char>& othe
 {
     if(this == &other) { return true; }
 
-    if(m_Length == other.Length() && m_Hash == other.HashCode())
+    if(m_Length == other.Length() && (::tau::string::StringHashCache::IsLazy || m_Hash.Peek() == other.HashCode()))
     {
-        return strCompare(m_Data.String() + m_Start, other.String(), m_Length) == 0;
+        return ::tau::string::simd::Equal(m_Data.String() + m_Start, other.String(), m_Length);
     }
     return false;
 }
@@ -1472,9 +1487,9 @@ inline constexpr bool DynStringViewT<Char>::Equals(const StringBaseT<Char>& othe
 template<typename Char>
 inline constexpr bool DynStringViewT<Char>::Equals(const ConstExprStringT<Char>& other) const noexcept
 {
-    if(m_Length == other.Length() && m_Hash == other.HashCode())
+    if(m_Length == other.Length() && !::tau::string::StringHashCache::Differ(m_Hash.Peek(), other.HashCode()))
     {
-        return strCompare(m_Data.String() + m_Start, other.String(), m_Length) == 0;
+        return ::tau::string::simd::Equal(m_Data.String() + m_Start, other.String(), m_Length);
     }
     return false;
 }
@@ -1482,9 +1497,9 @@ inline constexpr bool DynStringViewT<Char>::Equals(const ConstExprStringT<Char>&
 template<typename Char>
 inline constexpr bool DynStringViewT<Char>::Equals(const DynStringT<Char>& other) const noexcept
 {
-    if(m_Length == other.Length() && m_Hash == other.HashCode())
+    if(m_Length == other.Length() && !::tau::string::StringHashCache::Differ(m_Hash.Peek(), other.m_Hash.Peek()))
     {
-        return strCompare(m_Data.String() + m_Start, other.String(), m_Length) == 0;
+        return ::tau::string::simd::Equal(m_Data.String() + m_Start, other.String(), m_Length);
     }
     return false;
 }
@@ -1494,9 +1509,9 @@ inline constexpr bool DynStringViewT<Char>::Equals(const DynStringViewT<Char>& o
 {
     if(this == &other) { return true; }
 
-    if(m_Length == other.Length() && m_Hash == other.HashCode())
+    if(m_Length == other.Length() && !::tau::string::StringHashCache::Differ(m_Hash.Peek(), other.m_Hash.Peek()))
     {
-        return strCompare(m_Data.String() + m_Start, other.String(), m_Length) == 0;
+        return ::tau::string::simd::Equal(m_Data.String() + m_Start, other.String(), m_Length);
     }
     return false;
 }
@@ -1504,38 +1519,38 @@ inline constexpr bool DynStringViewT<Char>::Equals(const DynStringViewT<Char>& o
 template<typename Char>
 inline constexpr bool DynStringViewT<Char>::Equals(const Char* str) const noexcept
 {
-    return strCompare(m_Data.String() + m_Start, str, m_Length) == 0;
+    return strLength(str) == m_Length && ::tau::string::simd::Equal(m_Data.String() + m_Start, str, m_Length);
 }
 
 template<typename Char>
 inline constexpr i32 DynStringViewT<Char>::CompareTo(const StringBaseT<Char>& other) const noexcept
 {
-    return strCompare(m_Data.String() + m_Start, other.String(), minT(m_Length, other.Length()));
+    return ::tau::string::simd::Compare(m_Data.String() + m_Start, m_Length, other.String(), other.Length());
 }
 
 template<typename Char>
 inline constexpr i32 DynStringViewT<Char>::CompareTo(const ConstExprStringT<Char>& other) const noexcept
 {
-    return strCompare(m_Data.String() + m_Start, other.String(), minT(m_Length, other.Length()));
+    return ::tau::string::simd::Compare(m_Data.String() + m_Start, m_Length, other.String(), other.Length());
 }
 
 template<typename Char>
 inline constexpr i32 DynStringViewT<Char>::CompareTo(const DynStringViewT<Char>& other) const noexcept
 {
     if(this == &other) { return 0; }
-    return strCompare(m_Data.String() + m_Start, other.String(), minT(m_Length, other.Length()));
+    return ::tau::string::simd::Compare(m_Data.String() + m_Start, m_Length, other.String(), other.Length());
 }
 
 template<typename Char>
 inline constexpr i32 DynStringViewT<Char>::CompareTo(const DynStringT<Char>& other) const noexcept
 {
-    return strCompare(m_Data.String() + m_Start, other.String(), minT(m_Length, other.Length()));
+    return ::tau::string::simd::Compare(m_Data.String() + m_Start, m_Length, other.String(), other.Length());
 }
 
 template<typename Char>
 inline constexpr i32 DynStringViewT<Char>::CompareTo(const Char* str) const noexcept
 {
-    return strCompare(m_Data.String() + m_Start, str, m_Length);
+    return ::tau::string::simd::Compare(m_Data.String() + m_Start, m_Length, str, strLength(str));
 }
 
 template<typename Char>
@@ -1583,7 +1598,7 @@ inline constexpr DynStringT<Char> DynStringViewT<Char>::_concat(const uSys len,
         // (void) ::std::memcpy(tmp.String(), String(), m_Length * sizeof(Char));
         (void) ::std::ranges::copy_n(str, len, tmp.String() + Length());
         // (void) ::std::memcpy(tmp.String() + Length(), str, len * sizeof(Char));
-        tmp.m_Hash = findHashCode(tmp.String());
+        tmp.m_Hash = ::tau::string::StringHashCache(tmp.String(), newLen);
         return tmp;
     }
 }
@@ -1618,6 +1633,37 @@ inline constexpr DynStringT<Char> DynStringViewT<Char>::SubString(const uSys fro
     return SubStringLen(from, m_Length - from);
 }
 
+template<typename Char>
+inline constexpr uSys DynStringViewT<Char>::IndexOf(const Char c, const uSys from) const noexcept
+{
+    if(from >= m_Length) { return StringBaseT<Char>::NotFound; }
+
+    const uSys remaining = m_Length - from;
+    const uSys index = ::tau::string::simd::Find(String() + from, remaining, c);
+    return index == remaining ? StringBaseT<Char>::NotFound : from + index;
+}
+
+template<typename Char>
+inline constexpr uSys DynStringViewT<Char>::IndexOf(const StringBaseT<Char>& str, const uSys from) const noexcept
+{
+    if(from > m_Length) { return StringBaseT<Char>::NotFound; }
+
+    const uSys remaining = m_Length - from;
+    const uSys index = ::tau::string::simd::Find(String() + from, remaining, str.String(), str.Length());
+    return index == remaining && str.Length() != 0 ? StringBaseT<Char>::NotFound : from + index;
+}
+
+template<typename Char>
+inline constexpr uSys DynStringViewT<Char>::IndexOf(const Char* const str, const uSys from) const noexcept
+{
+    if(from > m_Length) { return StringBaseT<Char>::NotFound; }
+
+    const uSys length = strLength(str);
+    const uSys remaining = m_Length - from;
+    const uSys index = ::tau::string::simd::Find(String() + from, remaining, str, length);
+    return index == remaining && length != 0 ? StringBaseT<Char>::NotFound : from + index;
+}
+
 template<typename Char>
 inline constexpr Char DynStringViewT<Char>::operator[](const uSys index) const noexcept
 { return String()[index]; }
@@ -176,6 +176,19 @@ inline constexpr iSys TransformC16ToC32(const C16Alias* const inString, C32Alias
         iSys outCodeUnit = 0;
         for(iSys i = startingIndex; i < inCodeUnits; ++i)
         {
+            if(!flipEndian)
+            {
+                const iSys asciiUnits = ::tau::string::simd::TranscodeAscii(inString + i, outString + outCodeUnit, inCodeUnits - i, outCodeUnits - outCodeUnit);
+                i += asciiUnits;
+                outCodeUnit += asciiUnits;
+
+                if(i >= inCodeUnits)
+                { break; }
+
+                if(outCodeUnit >= outCodeUnits)
+                { return CalculateCodePoints<C16Alias>(inString, inCodeUnits, i, outCodeUnit); }
+            }
+
             const C32Alias c = DecodeCodePointForwardUnsafe<C16Alias>(inString, i, inCodeUnits, flipEndian);
             if(c == static_cast<c32>(-1))
             { return -1; }
@@ -217,6 +230,13 @@ inline constexpr iSys TransformC32ToC16(const C32Alias* const inString, C16Alias
         iSys outCodeUnit = skipBom ? 0 : 1;
         for(iSys i = 0; i < inCodeUnits; ++i)
         {
+            const iSys asciiUnits = ::tau::string::simd::TranscodeAscii(inString + i, outString + outCodeUnit, inCodeUnits - i, outCodeUnits - outCodeUnit, flipEndian);
+            i += asciiUnits;
+            outCodeUnit += asciiUnits;
+
+            if(i >= inCodeUnits)
+            { break; }
+
             const iSys priorCodeUnitsModifier = EncodeCodePoint<C16Alias>(inString[i], outString, outCodeUnit, outCodeUnits, flipEndian);
 
             if(priorCodeUnitsModifier == -1)
@@ -146,6 +146,16 @@ inline constexpr iSys TransformC8ToC32(const C8Alias* const inString, C32Alias*
         iSys outCodeUnit = 0;
         for(iSys i = startingIndex; i < inCodeUnits; ++i)
         {
+            const iSys asciiUnits = ::tau::string::simd::TranscodeAscii(inString + i, outString + outCodeUnit, inCodeUnits - i, outCodeUnits - outCodeUnit);
+            i += asciiUnits;
+            outCodeUnit += asciiUnits;
+
+            if(i >= inCodeUnits)
+            { break; }
+
+            if(outCodeUnit >= outCodeUnits)
+            { return CalculateCodePoints(inString, inCodeUnits, i, outCodeUnit); }
+
             const c32 c = DecodeCodePointForwardUnsafe(inString, i, inCodeUnits);
             if(c == static_cast<c32>(-1))
             { return -1; }
@@ -175,6 +185,13 @@ inline constexpr iSys TransformC32ToC8(const C32Alias* const inString, C8Alias*
         iSys outCodeUnit = 0;
         for(iSys i = 0; i < inCodeUnits; ++i)
         {
+            const iSys asciiUnits = ::tau::string::simd::TranscodeAscii(inString + i, outString + outCodeUnit, inCodeUnits - i, outCodeUnits - outCodeUnit);
+            i += asciiUnits;
+            outCodeUnit += asciiUnits;
+
+            if(i >= inCodeUnits)
+            { break; }
+
             const iSys priorCodeUnitsModifier = EncodeCodePoint(inString[i], outString, outCodeUnit, outCodeUnits);
 
             if(priorCodeUnitsModifier == -1)
@@ -48,6 +48,13 @@ inline constexpr iSys TransformC8ToC16(const C8Alias* const inString, C16Alias*
         iSys outCodeUnit = skipBom ? 0 : 1;
         for(iSys i = startingIndex; i < inCodeUnits; ++i)
         {
+            const iSys asciiUnits = ::tau::string::simd::TranscodeAscii(inString + i, outString + outCodeUnit, inCodeUnits - i, outCodeUnits - outCodeUnit, flipEndian);
+            i += asciiUnits;
+            outCodeUnit += asciiUnits;
+
+            if(i >= inCodeUnits)
+            { break; }
+
             const c32 c = utf8::DecodeCodePointForwardUnsafe<C8Alias>(inString, i, inCodeUnits);
             if(c == static_cast<c32>(-1))
             { return -1; }
@@ -104,6 +111,16 @@ inline constexpr iSys TransformC16ToC8(const C16Alias* const inString, C8Alias*
         iSys outCodeUnit = skipBom ? 0 : 3;
         for(iSys i = startingIndex; i < inCodeUnits; ++i)
         {
+            if(!flipEndian)
+            {
+                const iSys asciiUnits = ::tau::string::simd::TranscodeAscii(inString + i, outString + outCodeUnit, inCodeUnits - i, outCodeUnits - outCodeUnit);
+                i += asciiUnits;
+                outCodeUnit += asciiUnits;
+
+                if(i >= inCodeUnits)
+                { break; }
+            }
+
             const c32 c = DecodeCodePointForwardUnsafe<C16Alias>(inString, i, inCodeUnits, flipEndian);
             if(c == static_cast<c32>(-1))
             { return -1; }
@@ -55,6 +55,26 @@
   #define RESTRICT
 #endif
 
+#if defined(__GNUC__) || defined(__clang__)
+  #define PREFETCH(ADDRESS) __builtin_prefetch(ADDRESS)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #pragma warning(push, 0)
+  #include <xmmintrin.h>
+  #pragma warning(pop)
+  #define PREFETCH(ADDRESS) _mm_prefetch(reinterpret_cast<const char*>(ADDRESS), _MM_HINT_T0)
+#else
+  #define PREFETCH(ADDRESS)
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+  #define RETURN_ADDRESS() __builtin_return_address(0)
+#elif defined(_MSC_VER)
+  #include <intrin.h>
+  #define RETURN_ADDRESS() _ReturnAddress()
+#else
+  #define RETURN_ADDRESS() nullptr
+#endif
+
 #if defined(_WIN32)
   #define NOVTABLE __declspec(novtable)
 #else
@@ -0,0 +1,234 @@
+#pragma once
+
+#include "Objects.hpp"
+#include "NumTypes.hpp"
+#include "TauMacros.hpp"
+#include "TUMaths.hpp"
+#include <atomic>
+#include <new>
+#include <source_location>
+
+/**
+ *   The allocation statistics of a single allocator, used by
+ * `AllocationTracking::Profile`.
+ *
+ *   Every allocation is prefixed with a small header recording
+ * its size and call site, so deallocations can be attributed
+ * without a lookup. This tracks the number of live bytes and
+ * their peak, a histogram of allocation sizes in power of 2
+ * buckets, and per call site counts. A call site is either the
+ * return address of the call to `Allocate`, or a source location
+ * when one is given explicitly.
+ *
+ *   Call sites are kept in a fixed size table, once it fills up
+ * further call sites are merged into a single overflow entry.
+ *
+ *   Recording is lock free, the counters can be read at any
+ * time, but a set of reads is not a consistent snapshot while
+ * other threads are allocating.
+ */
+class AllocationProfile final
+{
+    DEFAULT_DESTRUCT(AllocationProfile);
+    DELETE_CM(AllocationProfile);
+public:
+    static constexpr uSys HeaderSize = 16;
+
+    /**
+     *   The largest allocation which can be profiled, adding the
+     * header to anything larger would overflow.
+     */
+    static constexpr uSys MaxSize = ~static_cast<uSys>(0) - HeaderSize;
+
+    static constexpr uSys HistogramBucketCount = 64;
+    static constexpr uSys MaxCallSites = 256;
+
+    /**
+     * The index of the entry call sites overflow into.
+     */
+    static constexpr uSys OverflowCallSite = MaxCallSites;
+
+    struct CallSite final
+    {
+        /**
+         *   The return address of the caller, or null if the site was
+         * recorded with a source location.
+         */
+        const void* Address;
+        const char* File;
+        const char* Function;
+        u32 Line;
+        ::std::atomic<uSys> AllocationCount;
+        ::std::atomic<uSys> LiveCount;
+        ::std::atomic<uSys> LiveBytes;
+        ::std::atomic<uSys> TotalBytes;
+    };
+private:
+    struct Header final
+    {
+        uSys Size;
+        uSys CallSiteIndex;
+    };
+
+    static_assert(sizeof(Header) <= HeaderSize);
+
+    /**
+     * Marks a call site slot which is being filled in.
+     */
+    static constexpr uPtr BusyKey = 1;
+public:
+    AllocationProfile() noexcept
+        : m_LiveBytes(0)
+        , m_PeakBytes(0)
+        , m_AllocationCount(0)
+        , m_DeallocationCount(0)
+        , m_Histogram { }
+        , m_Keys { }
+        , m_CallSites { }
+    { }
+
+    [[nodiscard]] uSys LiveBytes() const noexcept { return m_LiveBytes.load(::std::memory_order_relaxed); }
+    [[nodiscard]] uSys PeakBytes() const noexcept { return m_PeakBytes.load(::std::memory_order_relaxed); }
+    [[nodiscard]] uSys AllocationCount() const noexcept { return m_AllocationCount.load(::std::memory_order_relaxed); }
+    [[nodiscard]] uSys DeallocationCount() const noexcept { return m_DeallocationCount.load(::std::memory_order_relaxed); }
+
+    /**
+     *   The number of allocations whose size is in
+     * [2^bucket, 2^(bucket + 1)), bucket 0 also holds 0 byte
+     * allocations.
+     */
+    [[nodiscard]] uSys Histogram(const uSys bucket) const noexcept
+    { return bucket < HistogramBucketCount ? m_Histogram[bucket].load(::std::memory_order_relaxed) : 0; }
+
+    /**
+     *   Whether index refers to a call site which has been recorded,
+     * indices range from 0 to `OverflowCallSite` inclusive.
+     */
+    [[nodiscard]] bool HasCallSite(const uSys index) const noexcept
+    {
+        if(index == OverflowCallSite)
+        {
+            return m_CallSites[OverflowCallSite].AllocationCount.load(::std::memory_order_relaxed) != 0;
+        }
+
+        return index < MaxCallSites && m_Keys[index].load(::std::memory_order_acquire) > BusyKey;
+    }
+
+    [[nodiscard]] const CallSite& GetCallSite(const uSys index) const noexcept { return m_CallSites[index]; }
+
+    /**
+     *   Records an allocation of size bytes, raw must be at least
+     * `HeaderSize + size` bytes. Returns the pointer to give to
+     * the caller.
+     */
+    [[nodiscard]] void* Record(void* const raw, const uSys size, const void* const returnAddress) noexcept
+    { return Record(raw, size, FindCallSite(reinterpret_cast<uPtr>(returnAddress), returnAddress, nullptr, nullptr, 0)); }
+
+    [[nodiscard]] void* Record(void* const raw, const uSys size, const ::std::source_location& location) noexcept
+    {
+        // Keyed on the file name, the line tells apart sites in the same file.
+        return Record(raw, size, FindCallSite(reinterpret_cast<uPtr>(location.file_name()), nullptr, location.file_name(), location.function_name(), location.line()));
+    }
+
+    /**
+     *   Records the deallocation of obj, returning the raw pointer
+     * originally passed to `Record`.
+     */
+    [[nodiscard]] void* Release(void* const obj) noexcept
+    {
+        Header* const header = reinterpret_cast<Header*>(static_cast<u8*>(obj) - HeaderSize);
+        CallSite& site = m_CallSites[header->CallSiteIndex];
+
+        m_LiveBytes.fetch_sub(header->Size, ::std::memory_order_relaxed);
+        m_DeallocationCount.fetch_add(1, ::std::memory_order_relaxed);
+        site.LiveCount.fetch_sub(1, ::std::memory_order_relaxed);
+        site.LiveBytes.fetch_sub(header->Size, ::std::memory_order_relaxed);
+
+        return header;
+    }
+private:
+    [[nodiscard]] void* Record(void* const raw, const uSys size, const uSys callSiteIndex) noexcept
+    {
+        if(!raw)
+        {
+            return nullptr;
+        }
+
+        Header* const header = ::new(raw) Header { size, callSiteIndex };
+        CallSite& site = m_CallSites[callSiteIndex];
+
+        const uSys liveBytes = m_LiveBytes.fetch_add(size, ::std::memory_order_relaxed) + size;
+        uSys peakBytes = m_PeakBytes.load(::std::memory_order_relaxed);
+
+        while(liveBytes > peakBytes && !m_PeakBytes.compare_exchange_weak(peakBytes, liveBytes, ::std::memory_order_relaxed, ::std::memory_order_relaxed))
+        { }
+
+        m_AllocationCount.fetch_add(1, ::std::memory_order_relaxed);
+        m_Histogram[size == 0 ? 0 : log2i(static_cast<u64>(size))].fetch_add(1, ::std::memory_order_relaxed);
+
+        site.AllocationCount.fetch_add(1, ::std::memory_order_relaxed);
+        site.LiveCount.fetch_add(1, ::std::memory_order_relaxed);
+        site.LiveBytes.fetch_add(size, ::std::memory_order_relaxed);
+        site.TotalBytes.fetch_add(size, ::std::memory_order_relaxed);
+
+        return reinterpret_cast<u8*>(header) + HeaderSize;
+    }
+
+    /**
+     *   Finds or claims the slot for the pair of key and line with
+     * linear probing. Sites recorded by return address have a line
+     * of 0.
+     */
+    [[nodiscard]] uSys FindCallSite(uPtr key, const void* const address, const char* const file, const char* const function, const u32 line) noexcept
+    {
+        // Keys 0 and 1 are reserved for empty and busy slots.
+        if(key <= BusyKey)
+        {
+            key = BusyKey + 1;
+        }
+
+        static_assert(MaxCallSites == 256);
+        uSys index = static_cast<uSys>(((static_cast<u64>(key) ^ (static_cast<u64>(line) << 32)) * 0x9E3779B97F4A7C15ull) >> 56);
+
+        for(uSys i = 0; i < MaxCallSites; ++i)
+        {
+            ::std::atomic<uPtr>& slotKey = m_Keys[index];
+            uPtr current = slotKey.load(::std::memory_order_acquire);
+
+            if(current == 0 && slotKey.compare_exchange_strong(current, BusyKey, ::std::memory_order_acquire, ::std::memory_order_acquire))
+            {
+                CallSite& site = m_CallSites[index];
+                site.Address = address;
+                site.File = file;
+                site.Function = function;
+                site.Line = line;
+                slotKey.store(key, ::std::memory_order_release);
+                return index;
+            }
+
+            // Another thread is filling in this slot, it may be for the same key.
+            while(current == BusyKey)
+            {
+                current = slotKey.load(::std::memory_order_acquire);
+            }
+
+            // The key is published after the site is filled in, so its line can be read.
+            if(current == key && m_CallSites[index].Line == line)
+            {
+                return index;
+            }
+
+            index = index + 1 == MaxCallSites ? 0 : index + 1;
+        }
+
+        return OverflowCallSite;
+    }
+private:
+    ::std::atomic<uSys> m_LiveBytes;
+    ::std::atomic<uSys> m_PeakBytes;
+    ::std::atomic<uSys> m_AllocationCount;
+    ::std::atomic<uSys> m_DeallocationCount;
+    ::std::atomic<uSys> m_Histogram[HistogramBucketCount];
+    ::std::atomic<uPtr> m_Keys[MaxCallSites];
+    CallSite m_CallSites[MaxCallSites + 1];
+};
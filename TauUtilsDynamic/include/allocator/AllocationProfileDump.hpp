@@ -0,0 +1,118 @@
+#pragma once
+
+#include "AllocationProfile.hpp"
+#include "ConPrinter.hpp"
+#include "json/JsonWriter.hpp"
+
+/**
+ *   Prints a summary of profile to the console, followed by the
+ * non empty histogram buckets and every call site that has made
+ * an allocation.
+ */
+inline void PrintAllocationProfile(const AllocationProfile& profile) noexcept
+{
+    ConPrinter::PrintLn(u"Live Bytes: {}, Peak Bytes: {}, Allocations: {}, Deallocations: {}", profile.LiveBytes(), profile.PeakBytes(), profile.AllocationCount(), profile.DeallocationCount());
+
+    ConPrinter::PrintLn(u"Size Histogram:");
+
+    for(uSys i = 0; i < AllocationProfile::HistogramBucketCount; ++i)
+    {
+        if(const uSys count = profile.Histogram(i); count != 0)
+        {
+            ConPrinter::PrintLn(u"  [{}, {}): {}", i == 0 ? static_cast<uSys>(0) : static_cast<uSys>(1) << i, static_cast<u64>(2) << i, count);
+        }
+    }
+
+    ConPrinter::PrintLn(u"Call Sites:");
+
+    for(uSys i = 0; i <= AllocationProfile::OverflowCallSite; ++i)
+    {
+        if(!profile.HasCallSite(i))
+        {
+            continue;
+        }
+
+        const AllocationProfile::CallSite& site = profile.GetCallSite(i);
+
+        if(i == AllocationProfile::OverflowCallSite)
+        {
+            ConPrinter::Print(u"  <overflow>");
+        }
+        else if(site.File)
+        {
+            ConPrinter::Print(u"  {}:{} {}", site.File, site.Line, site.Function);
+        }
+        else
+        {
+            ConPrinter::Print(u"  {}", site.Address);
+        }
+
+        ConPrinter::PrintLn(u" Live: {} bytes in {} allocations, Total: {} bytes in {} allocations", site.LiveBytes.load(::std::memory_order_relaxed), site.LiveCount.load(::std::memory_order_relaxed), site.TotalBytes.load(::std::memory_order_relaxed), site.AllocationCount.load(::std::memory_order_relaxed));
+    }
+}
+
+/**
+ *   Builds a JSON object for profile. The histogram is an array
+ * indexed by bucket, call sites have either an `address` or a
+ * `file`, `line` and `function`. The overflow entry has neither.
+ */
+[[nodiscard]] inline ::tau::json::JRoot AllocationProfileToJson(const AllocationProfile& profile) noexcept
+{
+    ::tau::json::JRoot jRoot = ::tau::json::JRoot::CreateObject();
+    StrongRef<::tau::json::JObject> root = jRoot.Get().AsObject();
+
+    root->Insert(root, C8DynString(u8"liveBytes"), static_cast<u64>(profile.LiveBytes()));
+    root->Insert(root, C8DynString(u8"peakBytes"), static_cast<u64>(profile.PeakBytes()));
+    root->Insert(root, C8DynString(u8"allocations"), static_cast<u64>(profile.AllocationCount()));
+    root->Insert(root, C8DynString(u8"deallocations"), static_cast<u64>(profile.DeallocationCount()));
+
+    StrongRef<::tau::json::JArray> histogram = root->InsertArray(root, C8DynString(u8"histogram"));
+
+    for(uSys i = 0; i < AllocationProfile::HistogramBucketCount; ++i)
+    {
+        histogram->Append(histogram, static_cast<u64>(profile.Histogram(i)));
+    }
+
+    StrongRef<::tau::json::JArray> callSites = root->InsertArray(root, C8DynString(u8"callSites"));
+
+    for(uSys i = 0; i <= AllocationProfile::OverflowCallSite; ++i)
+    {
+        if(!profile.HasCallSite(i))
+        {
+            continue;
+        }
+
+        const AllocationProfile::CallSite& site = profile.GetCallSite(i);
+        StrongRef<::tau::json::JObject> jSite = callSites->AppendObject(callSites);
+
+        if(i != AllocationProfile::OverflowCallSite)
+        {
+            if(site.File)
+            {
+                jSite->Insert(jSite, C8DynString(u8"file"), C8DynString(reinterpret_cast<const c8*>(site.File)));
+                jSite->Insert(jSite, C8DynString(u8"line"), static_cast<u64>(site.Line));
+                jSite->Insert(jSite, C8DynString(u8"function"), C8DynString(reinterpret_cast<const c8*>(site.Function)));
+            }
+            else
+            {
+                jSite->Insert(jSite, C8DynString(u8"address"), static_cast<u64>(reinterpret_cast<uPtr>(site.Address)));
+            }
+        }
+
+        jSite->Insert(jSite, C8DynString(u8"liveBytes"), static_cast<u64>(site.LiveBytes.load(::std::memory_order_relaxed)));
+        jSite->Insert(jSite, C8DynString(u8"liveCount"), static_cast<u64>(site.LiveCount.load(::std::memory_order_relaxed)));
+        jSite->Insert(jSite, C8DynString(u8"totalBytes"), static_cast<u64>(site.TotalBytes.load(::std::memory_order_relaxed)));
+        jSite->Insert(jSite, C8DynString(u8"allocations"), static_cast<u64>(site.AllocationCount.load(::std::memory_order_relaxed)));
+    }
+
+    return jRoot;
+}
+
+[[nodiscard]] inline C8DynString WriteAllocationProfileJson(const AllocationProfile& profile) noexcept
+{
+    const ::tau::json::JRoot jRoot = AllocationProfileToJson(profile);
+
+    ::tau::json::JsonWriter writer;
+    writer.Begin(jRoot.Get().AsObject());
+    return writer.ToString();
+}
@@ -0,0 +1,298 @@
+#pragma once
+
+#include "Objects.hpp"
+#include "NumTypes.hpp"
+#include "TauAllocator.hpp"
+#include "PageAllocator.hpp"
+#include "TUMaths.hpp"
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+
+namespace tau::allocator {
+
+/**
+ *   A fixed block allocator which can be allocated from and
+ * deallocated to by any number of threads at once, without
+ * locking.
+ *
+ *   Freed blocks are kept on a Treiber stack. Rather than a
+ * pointer, the head of the stack stores the index of the top
+ * block along with a tag which is incremented by every push and
+ * pop. The two fit in a single 64 bit word, so the head can be
+ * swapped with a plain compare and exchange while still
+ * rejecting a stale head that happens to point at the same
+ * block again (the ABA problem). Blocks which have never been
+ * used are handed out by atomically bumping an index into the
+ * reserved pages, and pages are committed under a lock only
+ * when that index crosses into uncommitted memory.
+ *
+ *   Blocks may be freed on a different thread than they were
+ * allocated on. Like `FixedBlockAllocator`, `AllocTracking`
+ * selects whether allocations and double deletions are counted,
+ * the counters are atomic and remain accurate under
+ * concurrency.
+ *
+ *   See `FixedBlockAllocator` for advice on the number of pages
+ * to reserve. If `numaNode` is given, the pages are placed on
+ * that NUMA node, see `NodeLocalBlockAllocator`.
+ */
+template<AllocationTracking AllocTracking = AllocationTracking::None>
+class ConcurrentFixedBlockAllocator final : public TauAllocator
+{
+    DELETE_CM(ConcurrentFixedBlockAllocator);
+private:
+    static constexpr bool IsCounting = AllocTracking != AllocationTracking::None;
+    static constexpr bool IsDoubleDeleteCounting = AllocTracking == AllocationTracking::DoubleDeleteCount;
+    /**
+     * Space reserved before each block for its deallocation count.
+     */
+    static constexpr uSys HeaderSize = IsDoubleDeleteCounting ? sizeof(uSys) : 0;
+
+    /**
+     * Block indices are stored off by one, so that 0 is an empty stack.
+     */
+    static constexpr u64 EmptyHead = 0;
+public:
+    ConcurrentFixedBlockAllocator(const uSys blockSize, const PageCountVal numReservedPages = static_cast<PageCountVal>(1024), const uSys allocPages = 4, const u32 numaNode = PageAllocator::AnyNumaNode) noexcept
+        : m_AllocPages(nextPowerOf2(allocPages))
+        , m_ReservedPageCount(AlignTo(static_cast<uSys>(numReservedPages), m_AllocPages))
+        , m_Pages(static_cast<u8*>(PageAllocator::ReserveOnNode(m_ReservedPageCount, numaNode)))
+        , m_BlockSize(EffectiveBlockSize(blockSize))
+        , m_FreeHead(EmptyHead)
+        , m_AllocIndex(0)
+        , m_CommittedBytes(0)
+        , m_CommitMutex()
+        , m_AllocationDifference(0)
+        , m_DoubleDeleteCount(0)
+        , m_MultipleDeleteCount(0)
+    {
+        // Without a reservation nothing can be committed, so every allocation fails.
+        if(!m_Pages)
+        {
+            m_ReservedPageCount = 0;
+        }
+    }
+
+    ConcurrentFixedBlockAllocator(const uSys blockSize, const uSys maxElements, const uSys allocPages = 4, const u32 numaNode = PageAllocator::AnyNumaNode) noexcept
+        : m_AllocPages(nextPowerOf2(allocPages))
+        , m_ReservedPageCount(AlignTo((maxElements * EffectiveBlockSize(blockSize)) / PageAllocator::PageSize() + 1, m_AllocPages))
+        , m_Pages(static_cast<u8*>(PageAllocator::ReserveOnNode(m_ReservedPageCount, numaNode)))
+        , m_BlockSize(EffectiveBlockSize(blockSize))
+        , m_FreeHead(EmptyHead)
+        , m_AllocIndex(0)
+        , m_CommittedBytes(0)
+        , m_CommitMutex()
+        , m_AllocationDifference(0)
+        , m_DoubleDeleteCount(0)
+        , m_MultipleDeleteCount(0)
+    {
+        // Without a reservation nothing can be committed, so every allocation fails.
+        if(!m_Pages)
+        {
+            m_ReservedPageCount = 0;
+        }
+    }
+
+    ~ConcurrentFixedBlockAllocator() noexcept override
+    {
+        if(m_Pages)
+        {
+            PageAllocator::Free(m_Pages, m_ReservedPageCount);
+        }
+    }
+
+    [[nodiscard]] const void* head() const noexcept { return m_Pages; }
+    [[nodiscard]] uSys reservedPages() const noexcept { return m_ReservedPageCount; }
+    [[nodiscard]] uSys committedPages() const noexcept { return m_CommittedBytes.load(::std::memory_order_relaxed) / PageAllocator::PageSize(); }
+    [[nodiscard]] uSys blockSize() const noexcept { return m_BlockSize; }
+
+    [[nodiscard]] bool owns(const void* const obj) const noexcept
+    {
+        const u8* const address = static_cast<const u8*>(obj);
+        return address >= m_Pages && address < m_Pages + m_ReservedPageCount * PageAllocator::PageSize();
+    }
+
+    /**
+     *   Returns the difference in the number of allocations vs
+     * the number of deallocations.
+     */
+    template<AllocationTracking TrackingU = AllocTracking, ::std::enable_if_t<TrackingU != AllocationTracking::None, int> = 0>
+    [[nodiscard]] iSys allocationDifference() const noexcept { return m_AllocationDifference.load(::std::memory_order_relaxed); }
+
+    /**
+     * Returns the number of times objects were deleted twice.
+     */
+    template<AllocationTracking TrackingU = AllocTracking, ::std::enable_if_t<TrackingU == AllocationTracking::DoubleDeleteCount, int> = 0>
+    [[nodiscard]] uSys doubleDeleteCount() const noexcept { return m_DoubleDeleteCount.load(::std::memory_order_relaxed); }
+
+    /**
+     * Returns the number of deallocations beyond the first of any object.
+     */
+    template<AllocationTracking TrackingU = AllocTracking, ::std::enable_if_t<TrackingU == AllocationTracking::DoubleDeleteCount, int> = 0>
+    [[nodiscard]] uSys multipleDeleteCount() const noexcept { return m_MultipleDeleteCount.load(::std::memory_order_relaxed); }
+
+    [[nodiscard]] void* allocate() noexcept
+    {
+        u8* block = Pop();
+
+        if(!block)
+        {
+            block = Bump();
+
+            if(!block)
+            {
+                return nullptr;
+            }
+        }
+
+        if constexpr(IsDoubleDeleteCounting)
+        {
+            ::std::atomic_ref<uSys>(*reinterpret_cast<uSys*>(block)).store(0, ::std::memory_order_relaxed);
+        }
+
+        if constexpr(IsCounting)
+        {
+            (void) m_AllocationDifference.fetch_add(1, ::std::memory_order_relaxed);
+        }
+
+        return block + HeaderSize;
+    }
+
+    [[nodiscard]] void* Allocate(uSys) noexcept override { return allocate(); }
+
+    void Deallocate(void* const obj) noexcept override
+    {
+        if(!obj)
+        {
+            return;
+        }
+
+        u8* const block = static_cast<u8*>(obj) - HeaderSize;
+
+        if constexpr(IsCounting)
+        {
+            (void) m_AllocationDifference.fetch_sub(1, ::std::memory_order_relaxed);
+        }
+
+        if constexpr(IsDoubleDeleteCounting)
+        {
+            const uSys previousCount = ::std::atomic_ref<uSys>(*reinterpret_cast<uSys*>(block)).fetch_add(1, ::std::memory_order_relaxed);
+
+            if(previousCount > 0)
+            {
+                (void) m_MultipleDeleteCount.fetch_add(1, ::std::memory_order_relaxed);
+
+                if(previousCount == 1)
+                {
+                    (void) m_DoubleDeleteCount.fetch_add(1, ::std::memory_order_relaxed);
+                }
+
+                return;
+            }
+        }
+
+        Push(block);
+    }
+private:
+    [[nodiscard]] u8* Pop() noexcept
+    {
+        u64 head = m_FreeHead.load(::std::memory_order_acquire);
+
+        while(HeadIndex(head) != 0)
+        {
+            u8* const block = BlockAt(HeadIndex(head) - 1);
+
+            // Another thread may pop and reuse this block first, the tag makes the exchange fail if it did.
+            const u32 next = Link(block).load(::std::memory_order_relaxed);
+
+            if(m_FreeHead.compare_exchange_weak(head, MakeHead(next, HeadTag(head) + 1), ::std::memory_order_acquire, ::std::memory_order_acquire))
+            {
+                return block;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void Push(u8* const block) noexcept
+    {
+        const u32 index = static_cast<u32>((block - m_Pages) / m_BlockSize) + 1;
+        u64 head = m_FreeHead.load(::std::memory_order_relaxed);
+
+        do
+        {
+            Link(block).store(HeadIndex(head), ::std::memory_order_relaxed);
+        } while(!m_FreeHead.compare_exchange_weak(head, MakeHead(index, HeadTag(head) + 1), ::std::memory_order_release, ::std::memory_order_relaxed));
+    }
+
+    /**
+     *   Carves a block which has never been used out of the reserved
+     * pages, committing more pages if needed.
+     */
+    [[nodiscard]] u8* Bump() noexcept
+    {
+        const uSys reservedBytes = m_ReservedPageCount * PageAllocator::PageSize();
+        const uSys offset = m_AllocIndex.fetch_add(m_BlockSize, ::std::memory_order_relaxed);
+
+        if(offset + m_BlockSize > reservedBytes || (offset / m_BlockSize) >= static_cast<uSys>(0xFFFFFFFFu))
+        {
+            return nullptr;
+        }
+
+        if(offset + m_BlockSize > m_CommittedBytes.load(::std::memory_order_acquire))
+        {
+            ::std::lock_guard lock(m_CommitMutex);
+
+            uSys committedBytes = m_CommittedBytes.load(::std::memory_order_relaxed);
+
+            while(offset + m_BlockSize > committedBytes)
+            {
+                (void) PageAllocator::CommitPages(m_Pages + committedBytes, m_AllocPages);
+                committedBytes += m_AllocPages * PageAllocator::PageSize();
+            }
+
+            m_CommittedBytes.store(committedBytes, ::std::memory_order_release);
+        }
+
+        return m_Pages + offset;
+    }
+
+    /**
+     *   The index of the next free block is stored in the first bytes
+     * of a free block, after the deallocation count if there is one.
+     */
+    [[nodiscard]] static ::std::atomic_ref<u32> Link(u8* const block) noexcept
+    {
+        return ::std::atomic_ref<u32>(*reinterpret_cast<u32*>(block + HeaderSize));
+    }
+
+    /**
+     *   Blocks are kept pointer aligned so that the free list link
+     * can be accessed atomically.
+     */
+    [[nodiscard]] static uSys EffectiveBlockSize(const uSys blockSize) noexcept
+    {
+        return AlignTo(blockSize < sizeof(void*) ? sizeof(void*) : blockSize, sizeof(void*)) + HeaderSize;
+    }
+
+    [[nodiscard]] u8* BlockAt(const u32 index) const noexcept { return m_Pages + static_cast<uSys>(index) * m_BlockSize; }
+
+    [[nodiscard]] static u64 MakeHead(const u32 index, const u32 tag) noexcept { return (static_cast<u64>(tag) << 32) | index; }
+    [[nodiscard]] static u32 HeadIndex(const u64 head) noexcept { return static_cast<u32>(head); }
+    [[nodiscard]] static u32 HeadTag(const u64 head) noexcept { return static_cast<u32>(head >> 32); }
+private:
+    uSys m_AllocPages;
+    uSys m_ReservedPageCount;
+    u8* m_Pages;
+    uSys m_BlockSize;
+    ::std::atomic<u64> m_FreeHead;
+    ::std::atomic<uSys> m_AllocIndex;
+    ::std::atomic<uSys> m_CommittedBytes;
+    ::std::mutex m_CommitMutex;
+    ::std::atomic<iSys> m_AllocationDifference;
+    ::std::atomic<uSys> m_DoubleDeleteCount;
+    ::std::atomic<uSys> m_MultipleDeleteCount;
+};
+
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "Objects.hpp"
+#include "NumTypes.hpp"
+#include "TauAllocator.hpp"
+#include "TUMaths.hpp"
+#include <atomic>
+#include <cassert>
+
+namespace tau::allocator {
+
+enum class RingProducerMode
+{
+    /**
+     * Only one thread at a time may allocate from the ring.
+     */
+    Single,
+    /**
+     * Any number of threads may allocate from the ring at once.
+     */
+    Multi
+};
+
+/**
+ *   A ring of fixed size slots for passing messages between
+ * threads without copying.
+ *
+ *   Producers allocate slots in ring order, fill them in, and
+ * hand them to consumers, which release them with `Deallocate`
+ * once they're done, on any thread and in any order. Unlike
+ * `RingAllocator` a slot is never handed out while it is still
+ * in use, instead `Allocate` returns null when the next slot in
+ * the ring hasn't been released yet. This is the backpressure
+ * signal, a producer should back off until consumers catch up,
+ * `IsFull` can be polled to check without allocating. Because
+ * slots are handed out in order, a single slot held for a long
+ * time stalls the ring once the producers wrap around to it.
+ *
+ *   Every slot carries a sequence number recording the lap of
+ * the ring it was last allocated or released on, so both
+ * allocating and releasing are lock free (see Vyukov's bounded
+ * MPMC queue). With a single producer, allocating doesn't need
+ * a compare and exchange.
+ *
+ *   Releasing a slot twice is ignored, it is asserted against in
+ * debug builds.
+ */
+template<RingProducerMode ProducerMode = RingProducerMode::Multi, AllocationAlignment Alignment = AllocationAlignment { 16 }>
+class ConcurrentRingAllocator final : public TauAllocator
+{
+    DELETE_CM(ConcurrentRingAllocator);
+private:
+    static constexpr uSys SlotAlignment = static_cast<uSys>(Alignment) > sizeof(uSys) ? static_cast<uSys>(Alignment) : sizeof(uSys);
+
+    /**
+     * Space before each slot's payload for its sequence number.
+     */
+    static constexpr uSys HeaderSize = SlotAlignment;
+public:
+    /**
+     * elementCount must be at least 2.
+     */
+    ConcurrentRingAllocator(const uSys elementSize, const uSys elementCount, TauAllocator& allocator = DefaultTauAllocator::Instance()) noexcept
+        : m_ElementSize(elementSize)
+        , m_ElementCount(elementCount)
+        , m_SlotStride(HeaderSize + AlignTo(elementSize, SlotAlignment))
+        , m_Allocator(&allocator)
+        , m_RawPool(static_cast<u8*>(allocator.Allocate(m_SlotStride * elementCount + SlotAlignment)))
+        , m_Pool(reinterpret_cast<u8*>(AlignTo(reinterpret_cast<uPtr>(m_RawPool), static_cast<uPtr>(SlotAlignment))))
+        , m_Head(0)
+    {
+        assert(elementCount >= 2 && "A ring needs at least 2 slots.");
+
+        if(!m_RawPool)
+        {
+            m_Pool = nullptr;
+            m_ElementCount = 0;
+            return;
+        }
+
+        for(uSys i = 0; i < m_ElementCount; ++i)
+        {
+            new(&Sequence(i)) ::std::atomic<uSys>(i);
+        }
+    }
+
+    ~ConcurrentRingAllocator() noexcept override
+    { m_Allocator->Deallocate(m_RawPool); }
+
+    [[nodiscard]] uSys ElementSize() const noexcept { return m_ElementSize; }
+    [[nodiscard]] uSys ElementCount() const noexcept { return m_ElementCount; }
+
+    /**
+     *   Whether the next slot in the ring is still in use. With
+     * multiple producers this may be out of date as soon as it is
+     * returned.
+     */
+    [[nodiscard]] bool IsFull() const noexcept
+    {
+        if(m_ElementCount == 0)
+        {
+            return true;
+        }
+
+        const uSys position = m_Head.load(::std::memory_order_relaxed);
+        return Sequence(position % m_ElementCount).load(::std::memory_order_acquire) != position;
+    }
+
+    /**
+     * Returns null if size is larger than a slot or the ring is full.
+     */
+    [[nodiscard]] void* Allocate(const uSys size) noexcept override
+    {
+        if(size > m_ElementSize || m_ElementCount == 0)
+        {
+            return nullptr;
+        }
+
+        uSys position = m_Head.load(::std::memory_order_relaxed);
+
+        while(true)
+        {
+            const uSys index = position % m_ElementCount;
+            ::std::atomic<uSys>& sequence = Sequence(index);
+
+            // Pairs with the release in Deallocate, the consumer is finished with the slot.
+            const iSys lap = static_cast<iSys>(sequence.load(::std::memory_order_acquire) - position);
+
+            if(lap < 0)
+            {
+                // The slot hasn't been released since the previous lap.
+                return nullptr;
+            }
+
+            if(lap == 0)
+            {
+                if constexpr(ProducerMode == RingProducerMode::Single)
+                {
+                    m_Head.store(position + 1, ::std::memory_order_relaxed);
+                }
+                else if(!m_Head.compare_exchange_weak(position, position + 1, ::std::memory_order_relaxed, ::std::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                // Marks the slot as in use, one past its allocation position.
+                sequence.store(position + 1, ::std::memory_order_relaxed);
+                return m_Pool + index * m_SlotStride + HeaderSize;
+            }
+
+            // Another producer claimed this slot first.
+            position = m_Head.load(::std::memory_order_relaxed);
+        }
+    }
+
+    void Deallocate(void* const obj) noexcept override
+    {
+        if(!obj)
+        {
+            return;
+        }
+
+        const uSys index = static_cast<uSys>(static_cast<u8*>(obj) - m_Pool - HeaderSize) / m_SlotStride;
+        ::std::atomic<uSys>& sequence = Sequence(index);
+        const uSys inUseSequence = sequence.load(::std::memory_order_relaxed);
+
+        // An in use slot's sequence is one past a position that maps to it.
+        if((inUseSequence - 1) % m_ElementCount != index || inUseSequence == index)
+        {
+            assert(false && "Slot was released twice.");
+            return;
+        }
+
+        // Free for the next lap of the ring.
+        sequence.store(inUseSequence - 1 + m_ElementCount, ::std::memory_order_release);
+    }
+private:
+    [[nodiscard]] ::std::atomic<uSys>& Sequence(const uSys index) const noexcept
+    { return *reinterpret_cast<::std::atomic<uSys>*>(m_Pool + index * m_SlotStride); }
+private:
+    uSys m_ElementSize;
+    uSys m_ElementCount;
+    uSys m_SlotStride;
+    TauAllocator* m_Allocator;
+    u8* m_RawPool;
+    u8* m_Pool;
+    alignas(64) ::std::atomic<uSys> m_Head;
+};
+
+}
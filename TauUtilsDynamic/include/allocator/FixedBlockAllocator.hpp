@@ -94,7 +94,7 @@ public:
     { }
 
     ~FixedBlockAllocator() noexcept override
-    { PageAllocator::Free(_pages); }
+    { PageAllocator::Free(_pages, _numReservedPages); }
 
     [[nodiscard]] const void* head() const noexcept { return _pages; }
     [[nodiscard]] uSys reservedPages() const noexcept { return _numReservedPages; }
@@ -224,7 +224,7 @@ public:
     { }
 
     ~FixedBlockAllocator() noexcept override
-    { PageAllocator::Free(_pages); }
+    { PageAllocator::Free(_pages, _numReservedPages); }
     
     [[nodiscard]] const void* head() const noexcept { return _pages; }
     [[nodiscard]] uSys reservedPages() const noexcept { return _numReservedPages; }
@@ -375,7 +375,7 @@ public:
     { }
 
     ~FixedBlockAllocator() noexcept override
-    { PageAllocator::Free(_pages); }
+    { PageAllocator::Free(_pages, _numReservedPages); }
     
     [[nodiscard]] const void* head() const noexcept { return _pages; }
     [[nodiscard]] uSys reservedPages() const noexcept { return _numReservedPages; }
@@ -579,7 +579,7 @@ public:
     { }
 
     ~FixedBlockArenaAllocator() noexcept override
-    { PageAllocator::Free(_pages); }
+    { PageAllocator::Free(_pages, _numReservedPages); }
     
     [[nodiscard]] const void* head() const noexcept { return _pages; }
     [[nodiscard]] uSys reservedPages() const noexcept { return _numReservedPages; }
@@ -665,7 +665,7 @@ public:
     { }
 
     ~FixedBlockArenaAllocator() noexcept override
-    { PageAllocator::Free(_pages); }
+    { PageAllocator::Free(_pages, _numReservedPages); }
     
     [[nodiscard]] const void* head() const noexcept { return _pages; }
     [[nodiscard]] uSys reservedPages() const noexcept { return _numReservedPages; }
@@ -773,7 +773,7 @@ public:
     { }
 
     ~FixedBlockArenaAllocator() noexcept override
-    { PageAllocator::Free(_pages); }
+    { PageAllocator::Free(_pages, _numReservedPages); }
     
     [[nodiscard]] const void* head() const noexcept { return _pages; }
     [[nodiscard]] uSys reservedPages() const noexcept { return _numReservedPages; }
@@ -53,22 +53,25 @@ private:
 private:
     uSys _allocPages;
     uSys _numReservedPages;
+    PageKind _pageKind;
     void* _pages;
     uSys _committedPages;
     uSys _allocIndex;
 public:
-    FreeListAllocator(const PageCountVal numReservedPages = PageCountVal { 1024 }, const uSys allocPages = 4) noexcept
+    FreeListAllocator(const PageCountVal numReservedPages = PageCountVal { 1024 }, const uSys allocPages = 4, const PageKind pageKind = PageKind::Normal) noexcept
         : _allocPages(nextPowerOf2(allocPages))
         , _numReservedPages(AlignTo(static_cast<uSys>(numReservedPages), _allocPages))
-        , _pages(PageAllocator::Reserve(_numReservedPages))
+        , _pageKind(pageKind)
+        , _pages(PageAllocator::Reserve(_numReservedPages, _pageKind))
         , _committedPages(0)
         , _allocIndex(0)
     { }
 
-    FreeListAllocator(const uSys maxElements, const uSys allocPages = 4) noexcept
+    FreeListAllocator(const uSys maxElements, const uSys allocPages = 4, const PageKind pageKind = PageKind::Normal) noexcept
         : _allocPages(nextPowerOf2(allocPages))
         , _numReservedPages(AlignTo(static_cast<uSys>((maxElements * BlockSize) / PageAllocator::PageSize() + 1), _allocPages))
-        , _pages(PageAllocator::Reserve(_numReservedPages))
+        , _pageKind(pageKind)
+        , _pages(PageAllocator::Reserve(_numReservedPages, _pageKind))
         , _committedPages(0)
         , _allocIndex(0)
     { }
@@ -83,7 +86,7 @@ public:
             ReferenceCountingPointerBase* const base = reinterpret_cast<ReferenceCountingPointerBase* const>(reinterpret_cast<u8*>(_pages) + i);
             base->~ReferenceCountingPointerBase();
         }
-        PageAllocator::Free(_pages);
+        PageAllocator::Free(_pages, _numReservedPages, _pageKind);
     }
 
     [[nodiscard]] uSys blockSize() const noexcept { return BlockSize; }
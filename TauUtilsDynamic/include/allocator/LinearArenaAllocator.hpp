@@ -0,0 +1,179 @@
+#pragma once
+
+#include "Objects.hpp"
+#include "NumTypes.hpp"
+#include "TauAllocator.hpp"
+#include "PageAllocator.hpp"
+#include "TUMaths.hpp"
+#include <cassert>
+
+namespace tau::allocator {
+
+/**
+ *   A bump pointer allocator for variable sized allocations.
+ *
+ *   Allocations are carved out of a single reserved range in
+ * order, committing more pages as the end is reached, so an
+ * allocation is an alignment and a pointer bump. Individual
+ * allocations are never freed, `Deallocate` is a no-op.
+ * Instead the arena is rolled back in bulk, either to a point
+ * recorded with `Mark` or to the start with `Reset`.
+ *
+ *   Destructors are not run when the arena is rewound, objects
+ * with non-trivial destructors must be destroyed beforehand.
+ *
+ *   This allocator is not thread safe.
+ */
+class LinearArenaAllocator final : public TauAllocator
+{
+    DELETE_CM(LinearArenaAllocator);
+public:
+    /**
+     * A position in the arena, returned by `Mark`.
+     */
+    enum class Marker : uSys { };
+
+    /**
+     *   Marks the arena when constructed and rewinds to the mark
+     * when destroyed.
+     */
+    class Scope final
+    {
+        DELETE_CM(Scope);
+    public:
+        Scope(LinearArenaAllocator& arena) noexcept
+            : m_Arena(arena)
+            , m_Marker(arena.Mark())
+        { }
+
+        ~Scope() noexcept
+        { m_Arena.Rewind(m_Marker); }
+    private:
+        LinearArenaAllocator& m_Arena;
+        Marker m_Marker;
+    };
+public:
+    /**
+     *   commitPages are committed at a time as the arena grows. The
+     * default alignment is used by `Allocate(uSys)`, and must be a
+     * power of 2.
+     */
+    LinearArenaAllocator(const PageCountVal numReservedPages = static_cast<PageCountVal>(1024), const uSys commitPages = 16, const uSys defaultAlignment = 16) noexcept
+        : m_CommitPages(nextPowerOf2(commitPages))
+        , m_ReservedPageCount(AlignTo(static_cast<uSys>(numReservedPages), m_CommitPages))
+        , m_Pages(static_cast<u8*>(PageAllocator::Reserve(m_ReservedPageCount)))
+        , m_DefaultAlignment(defaultAlignment)
+        , m_Offset(0)
+        , m_CommittedBytes(0)
+    {
+        // Without a reservation nothing can be committed, so every allocation fails.
+        if(!m_Pages)
+        {
+            m_ReservedPageCount = 0;
+        }
+    }
+
+    ~LinearArenaAllocator() noexcept override
+    {
+        if(m_Pages)
+        {
+            PageAllocator::Free(m_Pages, m_ReservedPageCount);
+        }
+    }
+
+    [[nodiscard]] uSys ReservedPages() const noexcept { return m_ReservedPageCount; }
+    [[nodiscard]] uSys CommittedPages() const noexcept { return m_CommittedBytes / PageAllocator::PageSize(); }
+    [[nodiscard]] uSys BytesUsed() const noexcept { return m_Offset; }
+
+    [[nodiscard]] void* Allocate(const uSys size) noexcept override
+    { return Allocate(size, m_DefaultAlignment); }
+
+    /**
+     * alignment must be a power of 2.
+     */
+    [[nodiscard]] void* Allocate(const uSys size, const uSys alignment) noexcept
+    {
+        assert((alignment & (alignment - 1)) == 0 && "Alignment must be a power of 2.");
+
+        // The base is page aligned, so aligning the offset aligns the address.
+        const uSys begin = (m_Offset + alignment - 1) & ~(alignment - 1);
+        const uSys reservedBytes = m_ReservedPageCount * PageAllocator::PageSize();
+
+        // Checked before adding so a huge size can't wrap end around.
+        if(begin < m_Offset || begin > reservedBytes || size > reservedBytes - begin)
+        {
+            return nullptr;
+        }
+
+        const uSys end = begin + size;
+
+        if(end > m_CommittedBytes && !Commit(end))
+        {
+            return nullptr;
+        }
+
+        m_Offset = end;
+        return m_Pages + begin;
+    }
+
+    void Deallocate(void* const obj) noexcept override
+    { (void) obj; }
+
+    [[nodiscard]] Marker Mark() const noexcept { return static_cast<Marker>(m_Offset); }
+
+    /**
+     *   Frees everything allocated since marker was created. Rewinding
+     * to a marker invalidates any markers created after it.
+     */
+    void Rewind(const Marker marker) noexcept
+    {
+        assert(static_cast<uSys>(marker) <= m_Offset && "Rewound to a marker past the end of the arena.");
+        m_Offset = static_cast<uSys>(marker);
+    }
+
+    /**
+     *   Frees every allocation. If releasePages is set the committed
+     * pages are decommitted as well. On Windows this returns them to
+     * the system, on Linux it only makes them inaccessible until the
+     * arena grows into them again.
+     */
+    void Reset(const bool releasePages = false) noexcept
+    {
+        m_Offset = 0;
+
+        if(releasePages && m_CommittedBytes != 0)
+        {
+            PageAllocator::DecommitPages(m_Pages, m_CommittedBytes / PageAllocator::PageSize());
+            m_CommittedBytes = 0;
+        }
+    }
+private:
+    /**
+     * Commits enough pages for the arena to hold end bytes.
+     */
+    [[nodiscard]] bool Commit(const uSys end) noexcept
+    {
+        // The reservation is a whole number of chunks, so once end fits
+        // aligning it can't overflow or pass the reservation.
+        if(end > m_ReservedPageCount * PageAllocator::PageSize())
+        {
+            return false;
+        }
+
+        const uSys chunkBytes = m_CommitPages * PageAllocator::PageSize();
+        const uSys committedBytes = AlignTo(end, chunkBytes);
+
+        (void) PageAllocator::CommitPages(m_Pages + m_CommittedBytes, (committedBytes - m_CommittedBytes) / PageAllocator::PageSize());
+        m_CommittedBytes = committedBytes;
+        return true;
+    }
+private:
+    uSys m_CommitPages;
+    uSys m_ReservedPageCount;
+    u8* m_Pages;
+    uSys m_DefaultAlignment;
+    uSys m_Offset;
+    uSys m_CommittedBytes;
+};
+
+}
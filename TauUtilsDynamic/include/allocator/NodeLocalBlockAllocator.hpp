@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Objects.hpp"
+#include "NumTypes.hpp"
+#include "TauAllocator.hpp"
+#include "PageAllocator.hpp"
+#include "ConcurrentFixedBlockAllocator.hpp"
+
+namespace tau::allocator {
+
+/**
+ *   A fixed block allocator which keeps a separate arena on each
+ * NUMA node.
+ *
+ *   Each arena is a `ConcurrentFixedBlockAllocator` whose pages
+ * are placed on its node. Allocations are served from the arena
+ * of the node the calling thread is running on, so threads
+ * pinned to a socket receive socket local memory. If that arena
+ * is exhausted the other nodes are tried in turn. Blocks are
+ * always returned to the arena they came from, whichever thread
+ * frees them.
+ *
+ *   On systems without NUMA there is a single arena and this
+ * behaves like a `ConcurrentFixedBlockAllocator`.
+ */
+template<AllocationTracking AllocTracking = AllocationTracking::None>
+class NodeLocalBlockAllocator final : public TauAllocator
+{
+    DELETE_CM(NodeLocalBlockAllocator);
+public:
+    using NodeAllocator = ConcurrentFixedBlockAllocator<AllocTracking>;
+
+    static constexpr uSys MaxNodeCount = 64;
+public:
+    NodeLocalBlockAllocator(const uSys blockSize, const uSys maxElementsPerNode, const uSys allocPages = 4) noexcept
+        : m_BlockSize(blockSize)
+        , m_NodeCount(PageAllocator::NumaNodeCount() < MaxNodeCount ? PageAllocator::NumaNodeCount() : MaxNodeCount)
+        , m_Nodes { }
+    {
+        for(uSys i = 0; i < m_NodeCount; ++i)
+        {
+            m_Nodes[i] = DefaultTauAllocator::Instance().AllocateT<NodeAllocator>(blockSize, maxElementsPerNode, allocPages, static_cast<u32>(i));
+        }
+    }
+
+    ~NodeLocalBlockAllocator() noexcept override
+    {
+        for(uSys i = 0; i < m_NodeCount; ++i)
+        {
+            DefaultTauAllocator::Instance().DeallocateT(m_Nodes[i]);
+        }
+    }
+
+    [[nodiscard]] uSys BlockSize() const noexcept { return m_BlockSize; }
+    [[nodiscard]] uSys NodeCount() const noexcept { return m_NodeCount; }
+
+    /**
+     * The arena of a single node, or null if it couldn't be created.
+     */
+    [[nodiscard]]       NodeAllocator* Node(const uSys node)       noexcept { return node < m_NodeCount ? m_Nodes[node] : nullptr; }
+    [[nodiscard]] const NodeAllocator* Node(const uSys node) const noexcept { return node < m_NodeCount ? m_Nodes[node] : nullptr; }
+
+    [[nodiscard]] void* Allocate(const uSys size) noexcept override
+    {
+        if(size > m_BlockSize)
+        {
+            return nullptr;
+        }
+
+        uSys node = PageAllocator::CurrentNumaNode();
+
+        if(node >= m_NodeCount)
+        {
+            node = 0;
+        }
+
+        for(uSys i = 0; i < m_NodeCount; ++i)
+        {
+            if(NodeAllocator* const allocator = m_Nodes[node])
+            {
+                if(void* const block = allocator->allocate())
+                {
+                    return block;
+                }
+            }
+
+            node = node + 1 == m_NodeCount ? 0 : node + 1;
+        }
+
+        return nullptr;
+    }
+
+    void Deallocate(void* const obj) noexcept override
+    {
+        if(!obj)
+        {
+            return;
+        }
+
+        for(uSys i = 0; i < m_NodeCount; ++i)
+        {
+            if(m_Nodes[i] && m_Nodes[i]->owns(obj))
+            {
+                m_Nodes[i]->Deallocate(obj);
+                return;
+            }
+        }
+    }
+private:
+    uSys m_BlockSize;
+    uSys m_NodeCount;
+    NodeAllocator* m_Nodes[MaxNodeCount];
+};
+
+}
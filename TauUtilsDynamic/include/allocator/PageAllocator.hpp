@@ -4,18 +4,51 @@
 #include "Objects.hpp"
 #include "TUConfig.hpp"
 
+/**
+ *   The size of the pages backing a range of memory.
+ *
+ *   Mapping a large range with bigger pages reduces the number
+ * of TLB entries needed to cover it, which matters once a
+ * reservation reaches into the gigabytes.
+ */
+enum class PageKind : u8
+{
+    /**
+     * The system's base page size.
+     */
+    Normal = 0,
+    /**
+     * The default huge page size, 2 MiB on x86-64.
+     */
+    Large,
+    /**
+     *   1 GiB pages. Where these aren't supported, or on Linux when
+     * no 1 GiB pages have been set aside, this behaves like
+     * `Large`.
+     */
+    Huge
+};
+
 class TAU_UTILS_LIB PageAllocator final
 {
     DELETE_CONSTRUCT(PageAllocator);
     DELETE_DESTRUCT(PageAllocator);
     DELETE_CM(PageAllocator);
+public:
+    /**
+     * Passed as a NUMA node to place pages wherever the system chooses.
+     */
+    static constexpr u32 AnyNumaNode = 0xFFFFFFFF;
 public:
     static void Init() noexcept;
 
+    /**
+     * Reserves numPages without committing them, returns null on failure.
+     */
     [[nodiscard]] static void* Reserve(uSys numPages) noexcept;
 
     /**
-     * Reserves and commits the pages.
+     * Reserves and commits the pages, returns null on failure.
      */
     [[nodiscard]] static void* Alloc(uSys numPages) noexcept;
 
@@ -27,6 +60,136 @@ public:
 
     static void Free(void* page, uSys pageCount = 1) noexcept;
 
+    /**
+     *   Reserves numPages, counted in normal pages, backed by pages
+     * of the given kind. The reservation is rounded up to a whole
+     * number of large pages, see `RoundPageCount`.
+     *
+     *   Explicit huge pages (`MAP_HUGETLB` or `MEM_LARGE_PAGES`) are
+     * tried first. These come from a pool configured by the
+     * system administrator and are claimed in full up front, they
+     * are also committed immediately. `CommitPages` is harmless on
+     * them, but `DecommitPages` never returns their memory to the
+     * pool, on Linux it only makes the range inaccessible until it
+     * is committed again. Only `Free` releases them. If the pool
+     * cannot satisfy the request this falls back to a normal
+     * reservation aligned to the large page size which, on Linux,
+     * is marked with `MADV_HUGEPAGE` so that transparent huge pages
+     * are used when committed ranges fill whole large pages.
+     *
+     *   The range must be freed with `Free(page, numPages, kind)`.
+     */
+    [[nodiscard]] static void* Reserve(uSys numPages, PageKind kind) noexcept;
+
+    /**
+     * Reserves and commits the pages, see `Reserve(uSys, PageKind)`.
+     */
+    [[nodiscard]] static void* Alloc(uSys numPages, PageKind kind) noexcept;
+
+    /**
+     *   Frees a range from `Reserve(uSys, PageKind)` or
+     * `Alloc(uSys, PageKind)`, pageCount is the number of pages
+     * originally requested.
+     */
+    static void Free(void* page, uSys pageCount, PageKind kind) noexcept;
+
+    /**
+     *   The number of NUMA nodes in the system, 1 if the system has
+     * no NUMA support.
+     */
+    [[nodiscard]] static uSys NumaNodeCount() noexcept
+    {
+        if(!m_Initialized)
+        { Init(); }
+        return m_NumaNodeCount;
+    }
+
+    /**
+     *   The NUMA node of the processor the calling thread is
+     * running on. Unless the thread is pinned this may be stale as
+     * soon as it is returned.
+     */
+    [[nodiscard]] static u32 CurrentNumaNode() noexcept;
+
+    /**
+     *   Reserves pages that prefer to be placed on the given NUMA
+     * node once committed. If the node runs out of memory pages
+     * are placed on other nodes instead.
+     *
+     *   Pages committed from this range with `CommitPages` keep the
+     * node preference, the range can be freed with `Free`.
+     */
+    [[nodiscard]] static void* ReserveOnNode(uSys numPages, u32 node) noexcept;
+
+    /**
+     * Reserves and commits the pages, see `ReserveOnNode`.
+     */
+    [[nodiscard]] static void* AllocOnNode(uSys numPages, u32 node) noexcept;
+
+    /**
+     *   Commits pages that prefer to be placed on the given NUMA
+     * node, regardless of how they were reserved. Pages which
+     * have already been touched are migrated where possible.
+     */
+    static void* CommitPagesOnNode(void* page, uSys pageCount, u32 node) noexcept;
+
+    /**
+     *   Reserves numPages backed by the file at path instead of
+     * anonymous memory, creating the file if it doesn't exist.
+     *
+     *   A file smaller than the reservation is grown to cover it.
+     * On file systems that support sparse files this doesn't
+     * allocate any disk space until the pages are written. Like
+     * `Reserve`, pages must be committed with `CommitPages` before
+     * use. Writes reach the file in the background, `FlushPages`
+     * forces them out.
+     *
+     *   If existingBytes is not null it receives the size of the
+     * file before it was opened, 0 if it was just created. Returns
+     * null on failure. The range must be freed with `FreeFile`.
+     */
+    [[nodiscard]] static void* ReserveFile(const char* path, uSys numPages, uSys* existingBytes = nullptr) noexcept;
+
+    /**
+     *   Writes any modified pages of a file backed range to the
+     * file, returning once they have been written.
+     */
+    static void FlushPages(void* page, uSys pageCount) noexcept;
+
+    static void FreeFile(void* page, uSys pageCount) noexcept;
+
+    /**
+     *   Returns the size in bytes of a page of the given kind, or 0
+     * if the system doesn't support it at all.
+     */
+    [[nodiscard]] static uSys PageSize(const PageKind kind) noexcept
+    {
+        if(!m_Initialized)
+        { Init(); }
+
+        switch(kind)
+        {
+            case PageKind::Large: return m_LargePageSize;
+            case PageKind::Huge: return m_HugePageSize;
+            default: return m_PageSize;
+        }
+    }
+
+    /**
+     *   Rounds numPages, counted in normal pages, up to a whole
+     * number of pages of the given kind.
+     */
+    [[nodiscard]] static uSys RoundPageCount(const uSys numPages, const PageKind kind) noexcept
+    {
+        const uSys kindSize = PageSize(kind);
+
+        if(kind == PageKind::Normal || kindSize <= m_PageSize)
+        { return numPages; }
+
+        const uSys pagesPerKind = kindSize / m_PageSize;
+        return ((numPages + pagesPerKind - 1) / pagesPerKind) * pagesPerKind;
+    }
+
     static void SetReadWrite(void* page, uSys pageCount = 1) noexcept;
     static void SetReadOnly(void* page, uSys pageCount = 1) noexcept;
     static void SetExecute(void* page, uSys pageCount = 1) noexcept;
@@ -62,8 +225,13 @@ public:
     static void setExecute(void* const page, const uSys pageCount = 1) noexcept { SetExecute(page, pageCount); }
     
     [[nodiscard]] static uSys pageSize() noexcept { return PageSize(); }
+private:
+    [[nodiscard]] static void* MapLarge(uSys numPages, PageKind kind, bool commit) noexcept;
 private:
     static uSys m_PageSize;
+    static uSys m_LargePageSize;
+    static uSys m_HugePageSize;
+    static uSys m_NumaNodeCount;
     static bool m_Initialized;
 };
 
@@ -7,13 +7,79 @@
 #endif
 
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
 #include <unistd.h>
+#include <cstdio>
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+#endif
 
 inline void PageAllocator::Init() noexcept
 {
     if(!m_Initialized)
     {
         m_PageSize = static_cast<uSys>(getpagesize());
+        m_LargePageSize = 2 * 1024 * 1024;
+        m_HugePageSize = m_LargePageSize;
+
+#ifdef __linux__
+        if(FILE* const memInfo = fopen("/proc/meminfo", "r"))
+        {
+            char line[128];
+            unsigned long kibibytes;
+
+            while(fgets(line, sizeof(line), memInfo))
+            {
+                if(sscanf(line, "Hugepagesize: %lu kB", &kibibytes) == 1)
+                {
+                    m_LargePageSize = static_cast<uSys>(kibibytes) * 1024;
+                    break;
+                }
+            }
+
+            (void) fclose(memInfo);
+        }
+
+        m_HugePageSize = m_LargePageSize;
+
+        // The kernel may support 1 GiB pages without any being set aside for them, which is the default.
+        if(FILE* const hugePages = fopen("/sys/kernel/mm/hugepages/hugepages-1048576kB/nr_hugepages", "r"))
+        {
+            unsigned long hugePageCount = 0;
+
+            if(fscanf(hugePages, "%lu", &hugePageCount) == 1 && hugePageCount != 0)
+            { m_HugePageSize = 1024 * 1024 * 1024; }
+
+            (void) fclose(hugePages);
+        }
+
+        // Formatted as a list of ranges, such as "0-1" or "0,2-3", the highest node is last.
+        if(FILE* const nodes = fopen("/sys/devices/system/node/online", "r"))
+        {
+            char line[128];
+
+            if(fgets(line, sizeof(line), nodes))
+            {
+                unsigned long highestNode = 0;
+                const char* number = line;
+
+                for(const char* c = line; *c; ++c)
+                {
+                    if(*c == '-' || *c == ',')
+                    { number = c + 1; }
+                }
+
+                if(sscanf(number, "%lu", &highestNode) == 1)
+                { m_NumaNodeCount = static_cast<uSys>(highestNode) + 1; }
+            }
+
+            (void) fclose(nodes);
+        }
+#endif
 
         m_Initialized = true;
     }
@@ -21,12 +87,14 @@ inline void PageAllocator::Init() noexcept
 
 inline void* PageAllocator::Reserve(const uSys numPages) noexcept
 {
-    return mmap(nullptr, numPages * PageSize(), PROT_NONE, MAP_ANONYMOUS | MAP_SHARED, -1, 0);
+    void* const pages = mmap(nullptr, numPages * PageSize(), PROT_NONE, MAP_ANONYMOUS | MAP_SHARED, -1, 0);
+    return pages == MAP_FAILED ? nullptr : pages;
 }
 
 inline void* PageAllocator::Alloc(const uSys numPages) noexcept
 {
-    return mmap(nullptr, numPages * PageSize(), PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_SHARED, -1, 0);
+    void* const pages = mmap(nullptr, numPages * PageSize(), PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_SHARED, -1, 0);
+    return pages == MAP_FAILED ? nullptr : pages;
 }
 
 inline void* PageAllocator::CommitPage(void* const page) noexcept
@@ -56,6 +124,190 @@ inline void PageAllocator::Free(void* const page, const uSys pageCount) noexcept
     (void) munmap(page, pageCount * m_PageSize);
 }
 
+inline void* PageAllocator::Reserve(const uSys numPages, const PageKind kind) noexcept
+{
+    if(kind == PageKind::Normal)
+    { return Reserve(numPages); }
+
+    return MapLarge(numPages, kind, false);
+}
+
+inline void* PageAllocator::Alloc(const uSys numPages, const PageKind kind) noexcept
+{
+    if(kind == PageKind::Normal)
+    { return Alloc(numPages); }
+
+    return MapLarge(numPages, kind, true);
+}
+
+inline void PageAllocator::Free(void* const page, const uSys pageCount, const PageKind kind) noexcept
+{
+    (void) munmap(page, RoundPageCount(pageCount, kind) * m_PageSize);
+}
+
+inline void* PageAllocator::MapLarge(const uSys numPages, const PageKind kind, const bool commit) noexcept
+{
+    const uSys kindSize = PageSize(kind);
+    const uSys size = RoundPageCount(numPages, kind) * m_PageSize;
+    const int protection = commit ? PROT_READ | PROT_WRITE : PROT_NONE;
+
+    if(kindSize <= m_PageSize)
+    {
+        void* const pages = mmap(nullptr, size, protection, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+        return pages == MAP_FAILED ? nullptr : pages;
+    }
+
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+    {
+        int sizeShift = 0;
+        while((static_cast<uSys>(1) << sizeShift) < kindSize)
+        { ++sizeShift; }
+
+        // Huge TLB pages are taken from the pool when mapped, so there is nothing to defer committing.
+        void* const pages = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE | MAP_HUGETLB | (sizeShift << MAP_HUGE_SHIFT), -1, 0);
+
+        if(pages != MAP_FAILED)
+        { return pages; }
+    }
+#endif
+
+    // Reserve an extra large page worth of space so the range can be trimmed to be aligned.
+    const uSys slack = kindSize - m_PageSize;
+    u8* const raw = static_cast<u8*>(mmap(nullptr, size + slack, protection, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0));
+
+    if(raw == MAP_FAILED)
+    { return nullptr; }
+
+    u8* const aligned = reinterpret_cast<u8*>((reinterpret_cast<uPtr>(raw) + kindSize - 1) & ~static_cast<uPtr>(kindSize - 1));
+    const uSys head = static_cast<uSys>(aligned - raw);
+
+    if(head != 0)
+    { (void) munmap(raw, head); }
+    if(slack != head)
+    { (void) munmap(aligned + size, slack - head); }
+
+#ifdef MADV_HUGEPAGE
+    (void) madvise(aligned, size, MADV_HUGEPAGE);
+#endif
+
+    return aligned;
+}
+
+#ifdef __linux__
+namespace tau::internal {
+
+/**
+ *   Sets the memory policy of a range to prefer a single node.
+ * This uses the raw system call so that libnuma isn't required.
+ */
+inline void PreferNumaNode(void* const page, const uSys size, const u32 node, const unsigned flags) noexcept
+{
+    constexpr uSys MaskBits = sizeof(unsigned long) * 8;
+    constexpr uSys MaskLength = 16;
+
+    if(node >= MaskBits * MaskLength)
+    { return; }
+
+    unsigned long mask[MaskLength] = { };
+    mask[node / MaskBits] = 1ul << (node % MaskBits);
+
+    // The kernel ignores the last bit of the mask, so one more bit than the mask holds is passed.
+    (void) syscall(SYS_mbind, page, size, MPOL_PREFERRED, mask, MaskBits * MaskLength + 1, flags);
+}
+
+}
+#endif
+
+inline u32 PageAllocator::CurrentNumaNode() noexcept
+{
+#ifdef __linux__
+    unsigned cpu;
+    unsigned node;
+
+  #if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))
+    if(getcpu(&cpu, &node) == 0)
+    { return node; }
+  #else
+    if(syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+    { return node; }
+  #endif
+#endif
+    return 0;
+}
+
+inline void* PageAllocator::ReserveOnNode(const uSys numPages, const u32 node) noexcept
+{
+    void* const pages = Reserve(numPages);
+
+#ifdef __linux__
+    if(node != AnyNumaNode && pages && NumaNodeCount() > 1)
+    { tau::internal::PreferNumaNode(pages, numPages * m_PageSize, node, 0); }
+#else
+    (void) node;
+#endif
+
+    return pages;
+}
+
+inline void* PageAllocator::AllocOnNode(const uSys numPages, const u32 node) noexcept
+{
+    void* const pages = ReserveOnNode(numPages, node);
+
+    if(pages)
+    { (void) CommitPages(pages, numPages); }
+
+    return pages;
+}
+
+inline void* PageAllocator::CommitPagesOnNode(void* const page, const uSys pageCount, const u32 node) noexcept
+{
+#ifdef __linux__
+    if(node != AnyNumaNode && NumaNodeCount() > 1)
+    { tau::internal::PreferNumaNode(page, pageCount * m_PageSize, node, MPOL_MF_MOVE); }
+#else
+    (void) node;
+#endif
+
+    return CommitPages(page, pageCount);
+}
+
+inline void* PageAllocator::ReserveFile(const char* const path, const uSys numPages, uSys* const existingBytes) noexcept
+{
+    const int file = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+    if(file < 0)
+    { return nullptr; }
+
+    const uSys size = numPages * PageSize();
+    struct stat fileStat;
+
+    if(fstat(file, &fileStat) != 0 || (static_cast<uSys>(fileStat.st_size) < size && ftruncate(file, static_cast<off_t>(size)) != 0))
+    {
+        (void) close(file);
+        return nullptr;
+    }
+
+    if(existingBytes)
+    { *existingBytes = static_cast<uSys>(fileStat.st_size); }
+
+    void* const pages = mmap(nullptr, size, PROT_NONE, MAP_SHARED, file, 0);
+
+    // The mapping keeps its own reference to the file.
+    (void) close(file);
+
+    return pages == MAP_FAILED ? nullptr : pages;
+}
+
+inline void PageAllocator::FlushPages(void* const page, const uSys pageCount) noexcept
+{
+    (void) msync(page, pageCount * m_PageSize, MS_SYNC);
+}
+
+inline void PageAllocator::FreeFile(void* const page, const uSys pageCount) noexcept
+{
+    (void) munmap(page, pageCount * m_PageSize);
+}
+
 inline void PageAllocator::SetReadWrite(void* const page, const uSys pageCount) noexcept
 {
     (void) mprotect(page, pageCount * m_PageSize, PROT_READ | PROT_WRITE);
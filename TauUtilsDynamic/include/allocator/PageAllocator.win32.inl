@@ -9,6 +9,7 @@
 #pragma warning(push, 0)
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
+#include <winioctl.h>
 #pragma warning(pop)
 
 inline void PageAllocator::Init() noexcept
@@ -19,6 +20,12 @@ inline void PageAllocator::Init() noexcept
         GetSystemInfo(&sysInfo);
 
         m_PageSize = sysInfo.dwPageSize;
+        m_LargePageSize = static_cast<uSys>(GetLargePageMinimum());
+        m_HugePageSize = m_LargePageSize;
+
+        ULONG highestNode;
+        if(GetNumaHighestNodeNumber(&highestNode))
+        { m_NumaNodeCount = static_cast<uSys>(highestNode) + 1; }
 
         m_Initialized = true;
     }
@@ -60,6 +67,136 @@ inline void PageAllocator::Free(void* const page, const uSys pageCount) noexcept
     (void) VirtualFree(page, 0, MEM_RELEASE);
 }
 
+inline void* PageAllocator::Reserve(const uSys numPages, const PageKind kind) noexcept
+{
+    if(kind == PageKind::Normal)
+    { return Reserve(numPages); }
+
+    return MapLarge(numPages, kind, false);
+}
+
+inline void* PageAllocator::Alloc(const uSys numPages, const PageKind kind) noexcept
+{
+    if(kind == PageKind::Normal)
+    { return Alloc(numPages); }
+
+    return MapLarge(numPages, kind, true);
+}
+
+inline void PageAllocator::Free(void* const page, const uSys pageCount, const PageKind kind) noexcept
+{
+    (void) pageCount;
+    (void) kind;
+    (void) VirtualFree(page, 0, MEM_RELEASE);
+}
+
+inline void* PageAllocator::MapLarge(const uSys numPages, const PageKind kind, const bool commit) noexcept
+{
+    const uSys size = RoundPageCount(numPages, kind) * m_PageSize;
+
+    if(PageSize(kind) > m_PageSize)
+    {
+        /*   Large pages must be committed when they are reserved, and
+           require the SeLockMemoryPrivilege. */
+        void* const pages = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+
+        if(pages)
+        { return pages; }
+    }
+
+    if(commit)
+    { return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE); }
+
+    return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+}
+
+inline u32 PageAllocator::CurrentNumaNode() noexcept
+{
+    PROCESSOR_NUMBER processor;
+    GetCurrentProcessorNumberEx(&processor);
+
+    USHORT node;
+    if(GetNumaProcessorNodeEx(&processor, &node))
+    { return node; }
+
+    return 0;
+}
+
+inline void* PageAllocator::ReserveOnNode(const uSys numPages, const u32 node) noexcept
+{
+    if(node == AnyNumaNode)
+    { return Reserve(numPages); }
+
+    return VirtualAllocExNuma(GetCurrentProcess(), nullptr, numPages * PageSize(), MEM_RESERVE, PAGE_NOACCESS, node);
+}
+
+inline void* PageAllocator::AllocOnNode(const uSys numPages, const u32 node) noexcept
+{
+    if(node == AnyNumaNode)
+    { return Alloc(numPages); }
+
+    return VirtualAllocExNuma(GetCurrentProcess(), nullptr, numPages * PageSize(), MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, node);
+}
+
+inline void* PageAllocator::CommitPagesOnNode(void* const page, const uSys pageCount, const u32 node) noexcept
+{
+    if(node == AnyNumaNode)
+    { return CommitPages(page, pageCount); }
+
+    // Windows can't migrate pages which are already committed, this only affects new pages.
+    return VirtualAllocExNuma(GetCurrentProcess(), page, pageCount * m_PageSize, MEM_COMMIT, PAGE_READWRITE, node);
+}
+
+inline void* PageAllocator::ReserveFile(const char* const path, const uSys numPages, uSys* const existingBytes) noexcept
+{
+    const HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if(file == INVALID_HANDLE_VALUE)
+    { return nullptr; }
+
+    LARGE_INTEGER fileSize;
+
+    if(!GetFileSizeEx(file, &fileSize))
+    {
+        (void) CloseHandle(file);
+        return nullptr;
+    }
+
+    if(existingBytes)
+    { *existingBytes = static_cast<uSys>(fileSize.QuadPart); }
+
+    // Without this, growing the file to the size of the mapping would allocate all of it on disk.
+    DWORD bytesReturned;
+    (void) DeviceIoControl(file, FSCTL_SET_SPARSE, nullptr, 0, nullptr, 0, &bytesReturned, nullptr);
+
+    const u64 size = static_cast<u64>(numPages) * PageSize();
+
+    /*   File mappings can't be reserved and committed piecemeal,
+       the view is committed in full, making CommitPages and
+       DecommitPages no-ops. */
+    const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(size >> 32), static_cast<DWORD>(size), nullptr);
+    (void) CloseHandle(file);
+
+    if(!mapping)
+    { return nullptr; }
+
+    void* const pages = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, static_cast<SIZE_T>(size));
+    (void) CloseHandle(mapping);
+
+    return pages;
+}
+
+inline void PageAllocator::FlushPages(void* const page, const uSys pageCount) noexcept
+{
+    (void) FlushViewOfFile(page, pageCount * m_PageSize);
+}
+
+inline void PageAllocator::FreeFile(void* const page, const uSys pageCount) noexcept
+{
+    (void) pageCount;
+    (void) UnmapViewOfFile(page);
+}
+
 inline void PageAllocator::SetReadWrite(void* const page, const uSys pageCount) noexcept
 {
     DWORD oldProtect;
@@ -0,0 +1,432 @@
+#pragma once
+
+#include "Objects.hpp"
+#include "NumTypes.hpp"
+#include "TauAllocator.hpp"
+#include "PageAllocator.hpp"
+#include "TUMaths.hpp"
+#include <cassert>
+
+namespace tau::allocator {
+
+/**
+ *   A general purpose allocator which sorts allocations into
+ * size classes.
+ *
+ *   Small requests are rounded up to one of a fixed set of size
+ * classes, spaced like jemalloc's: multiples of 16 up to 128
+ * bytes, then four classes for every doubling up to
+ * `MaxSmallSize`. Each class carves objects out of runs, fixed
+ * size spans of pages taken from a single reserved range. A run
+ * holds objects of a single class along with a bitmap of which
+ * of them are free, so allocating is a scan for a set bit and
+ * deallocating clears one. Runs start at a fixed stride from the
+ * start of the range, so the run, and thus the size class, of
+ * any address is found with a subtraction and a division,
+ * without any per allocation header. Once a run is completely
+ * free its pages are decommitted and the run is reused by
+ * whichever class next needs one.
+ *
+ *   Requests larger than `MaxSmallSize` are given their own pages
+ * directly from `PageAllocator`.
+ *
+ *   Objects are aligned to 16 bytes, except for the 8 byte
+ * class.
+ *
+ *   This allocator is not thread safe. A thread pinned to a NUMA
+ * node can keep its own instance with the runs placed on that
+ * node.
+ */
+class SizeClassAllocator final : public TauAllocator
+{
+    DELETE_CM(SizeClassAllocator);
+public:
+    static constexpr uSys MaxSmallSize = 16384;
+    static constexpr uSys ClassCount = 37;
+    static constexpr uSys MinRunSize = 65536;
+private:
+    static constexpr uSys ObjectAlignment = 16;
+
+    struct Run final
+    {
+        Run* Next;
+        Run* Prev;
+        u32 ClassIndex;
+        u32 FreeCount;
+        /**
+         * No word before this has any free objects.
+         */
+        u32 SearchWord;
+        bool IsPartial;
+
+        [[nodiscard]] u64* Bitmap() noexcept { return reinterpret_cast<u64*>(this + 1); }
+    };
+
+    struct SizeClass final
+    {
+        uSys Size;
+        u32 ObjectCount;
+        u32 ObjectOffset;
+        u32 BitmapWords;
+        /**
+         *   The run new objects are allocated from. This is never in
+         * the partial list.
+         */
+        Run* Current;
+        /**
+         * Runs with at least one free object.
+         */
+        Run* Partial;
+    };
+
+    /**
+     * Placed before every large allocation.
+     */
+    struct alignas(ObjectAlignment) LargeHeader final
+    {
+        uSys PageCount;
+    };
+public:
+    /**
+     *   Reserving pages only consumes address space, pages are
+     * committed as runs are created. Runs are placed on numaNode,
+     * large allocations are not.
+     */
+    SizeClassAllocator(const PageCountVal numReservedPages = static_cast<PageCountVal>(262144), const u32 numaNode = PageAllocator::AnyNumaNode) noexcept
+        : m_RunSize(MinRunSize > PageAllocator::PageSize() ? MinRunSize : PageAllocator::PageSize())
+        , m_RunPageCount(m_RunSize / PageAllocator::PageSize())
+        , m_MaxRunCount(static_cast<uSys>(numReservedPages) / m_RunPageCount)
+        , m_Base(static_cast<u8*>(PageAllocator::ReserveOnNode(m_MaxRunCount * m_RunPageCount, numaNode)))
+        , m_RunCount(0)
+        , m_FreeRuns(nullptr)
+        , m_Classes { }
+    {
+        for(uSys i = 0; i < ClassCount; ++i)
+        {
+            InitClass(m_Classes[i], ClassSize(i));
+        }
+    }
+
+    ~SizeClassAllocator() noexcept override
+    {
+        if(m_Base)
+        {
+            PageAllocator::Free(m_Base, m_MaxRunCount * m_RunPageCount);
+        }
+    }
+
+    /**
+     * The number of bytes actually set aside for a request of size.
+     */
+    [[nodiscard]] static uSys RoundedSize(const uSys size) noexcept
+    {
+        return size > MaxSmallSize ? size : ClassSize(ClassIndex(size));
+    }
+
+    /**
+     * The number of runs which have ever been created.
+     */
+    [[nodiscard]] uSys RunCount() const noexcept { return m_RunCount; }
+
+    [[nodiscard]] void* Allocate(const uSys size) noexcept override
+    {
+        // The reservation failed, nothing can be allocated.
+        if(!m_Base)
+        {
+            return nullptr;
+        }
+
+        if(size > MaxSmallSize)
+        {
+            return AllocateLarge(size);
+        }
+
+        SizeClass& sizeClass = m_Classes[ClassIndex(size)];
+        Run* run = sizeClass.Current;
+
+        if(!run || run->FreeCount == 0)
+        {
+            run = sizeClass.Partial;
+
+            if(run)
+            {
+                RemovePartial(sizeClass, run);
+            }
+            else
+            {
+                run = CreateRun(static_cast<u32>(&sizeClass - m_Classes));
+
+                if(!run)
+                {
+                    return nullptr;
+                }
+            }
+
+            sizeClass.Current = run;
+        }
+
+        u64* const bitmap = run->Bitmap();
+        u32 word = run->SearchWord;
+
+        while(!bitmap[word])
+        {
+            ++word;
+        }
+
+        const uSys bit = static_cast<uSys>(CountTrailingZero(static_cast<u64>(bitmap[word])));
+        bitmap[word] &= bitmap[word] - 1;
+        run->SearchWord = word;
+        --run->FreeCount;
+
+        return reinterpret_cast<u8*>(run) + sizeClass.ObjectOffset + (static_cast<uSys>(word) * 64 + bit) * sizeClass.Size;
+    }
+
+    void Deallocate(void* const obj) noexcept override
+    {
+        if(!obj)
+        {
+            return;
+        }
+
+        u8* const address = static_cast<u8*>(obj);
+
+        if(address < m_Base || address >= m_Base + m_RunCount * m_RunSize)
+        {
+            DeallocateLarge(obj);
+            return;
+        }
+
+        Run* const run = reinterpret_cast<Run*>(m_Base + static_cast<uSys>(address - m_Base) / m_RunSize * m_RunSize);
+        SizeClass& sizeClass = m_Classes[run->ClassIndex];
+
+        const uSys index = static_cast<uSys>(address - reinterpret_cast<u8*>(run) - sizeClass.ObjectOffset) / sizeClass.Size;
+        const u32 word = static_cast<u32>(index / 64);
+        const u64 mask = static_cast<u64>(1) << (index % 64);
+
+        assert((run->Bitmap()[word] & mask) == 0 && "Object was deallocated twice.");
+
+        run->Bitmap()[word] |= mask;
+        ++run->FreeCount;
+
+        if(word < run->SearchWord)
+        {
+            run->SearchWord = word;
+        }
+
+        if(run == sizeClass.Current)
+        {
+            return;
+        }
+
+        if(run->FreeCount == sizeClass.ObjectCount)
+        {
+            if(run->IsPartial)
+            {
+                RemovePartial(sizeClass, run);
+            }
+
+            ReleaseRun(run);
+        }
+        else if(!run->IsPartial)
+        {
+            AddPartial(sizeClass, run);
+        }
+    }
+private:
+    /**
+     *   Maps a request size to its class, sizes up to 128 use
+     * classes 16 bytes apart, after which each doubling is split
+     * into four classes.
+     */
+    [[nodiscard]] static uSys ClassIndex(const uSys size) noexcept
+    {
+        if(size <= 8)
+        {
+            return 0;
+        }
+
+        if(size <= 128)
+        {
+            return (size + 15) / 16;
+        }
+
+        const uSys power = log2i(static_cast<u64>(size - 1));
+        const uSys quarter = ((size - 1) >> (power - 2)) & 3;
+        return 9 + (power - 7) * 4 + quarter;
+    }
+
+    [[nodiscard]] static uSys ClassSize(const uSys classIndex) noexcept
+    {
+        if(classIndex == 0)
+        {
+            return 8;
+        }
+
+        if(classIndex <= 8)
+        {
+            return classIndex * 16;
+        }
+
+        const uSys power = (classIndex - 9) / 4 + 7;
+        const uSys quarter = (classIndex - 9) % 4;
+        return (5 + quarter) << (power - 2);
+    }
+
+    void InitClass(SizeClass& sizeClass, const uSys size) const noexcept
+    {
+        // The bitmap shrinks the space for objects, which may shrink the bitmap.
+        uSys objectCount = (m_RunSize - sizeof(Run)) / size;
+        uSys objectOffset;
+
+        while(true)
+        {
+            objectOffset = AlignTo(sizeof(Run) + DivCeil<uSys>(objectCount, 64) * sizeof(u64), ObjectAlignment);
+
+            if(objectOffset + objectCount * size <= m_RunSize)
+            {
+                break;
+            }
+
+            --objectCount;
+        }
+
+        sizeClass.Size = size;
+        sizeClass.ObjectCount = static_cast<u32>(objectCount);
+        sizeClass.ObjectOffset = static_cast<u32>(objectOffset);
+        sizeClass.BitmapWords = static_cast<u32>(DivCeil<uSys>(objectCount, 64));
+        sizeClass.Current = nullptr;
+        sizeClass.Partial = nullptr;
+    }
+
+    [[nodiscard]] Run* CreateRun(const u32 classIndex) noexcept
+    {
+        Run* run = m_FreeRuns;
+
+        if(run)
+        {
+            m_FreeRuns = run->Next;
+            // The first page, holding the header, is never decommitted.
+            (void) PageAllocator::CommitPages(reinterpret_cast<u8*>(run) + PageAllocator::PageSize(), m_RunPageCount - 1);
+        }
+        else
+        {
+            if(m_RunCount == m_MaxRunCount)
+            {
+                return nullptr;
+            }
+
+            run = reinterpret_cast<Run*>(PageAllocator::CommitPages(m_Base + m_RunCount * m_RunSize, m_RunPageCount));
+            ++m_RunCount;
+        }
+
+        const SizeClass& sizeClass = m_Classes[classIndex];
+
+        run->Next = nullptr;
+        run->Prev = nullptr;
+        run->ClassIndex = classIndex;
+        run->FreeCount = sizeClass.ObjectCount;
+        run->SearchWord = 0;
+        run->IsPartial = false;
+
+        u64* const bitmap = run->Bitmap();
+
+        for(u32 i = 0; i < sizeClass.BitmapWords; ++i)
+        {
+            bitmap[i] = ~static_cast<u64>(0);
+        }
+
+        // Clear the bits past the last object so they are never handed out.
+        if(const u32 tailBits = sizeClass.ObjectCount % 64; tailBits != 0)
+        {
+            bitmap[sizeClass.BitmapWords - 1] = (static_cast<u64>(1) << tailBits) - 1;
+        }
+
+        return run;
+    }
+
+    void ReleaseRun(Run* const run) noexcept
+    {
+        if(m_RunPageCount > 1)
+        {
+            PageAllocator::DecommitPages(reinterpret_cast<u8*>(run) + PageAllocator::PageSize(), m_RunPageCount - 1);
+        }
+
+        run->Next = m_FreeRuns;
+        m_FreeRuns = run;
+    }
+
+    static void AddPartial(SizeClass& sizeClass, Run* const run) noexcept
+    {
+        run->Prev = nullptr;
+        run->Next = sizeClass.Partial;
+
+        if(sizeClass.Partial)
+        {
+            sizeClass.Partial->Prev = run;
+        }
+
+        sizeClass.Partial = run;
+        run->IsPartial = true;
+    }
+
+    static void RemovePartial(SizeClass& sizeClass, Run* const run) noexcept
+    {
+        if(run->Prev)
+        {
+            run->Prev->Next = run->Next;
+        }
+        else
+        {
+            sizeClass.Partial = run->Next;
+        }
+
+        if(run->Next)
+        {
+            run->Next->Prev = run->Prev;
+        }
+
+        run->Next = nullptr;
+        run->Prev = nullptr;
+        run->IsPartial = false;
+    }
+
+    [[nodiscard]] static void* AllocateLarge(const uSys size) noexcept
+    {
+        // Adding the header would wrap around to a tiny page count.
+        if(size > ~static_cast<uSys>(0) - sizeof(LargeHeader))
+        {
+            return nullptr;
+        }
+
+        const uSys pageCount = DivCeil(size + sizeof(LargeHeader), PageAllocator::PageSize());
+        LargeHeader* const header = static_cast<LargeHeader*>(PageAllocator::Alloc(pageCount));
+
+        if(!header)
+        {
+            return nullptr;
+        }
+
+        header->PageCount = pageCount;
+        return header + 1;
+    }
+
+    static void DeallocateLarge(void* const obj) noexcept
+    {
+        LargeHeader* const header = static_cast<LargeHeader*>(obj) - 1;
+        PageAllocator::Free(header, header->PageCount);
+    }
+private:
+    uSys m_RunSize;
+    uSys m_RunPageCount;
+    uSys m_MaxRunCount;
+    u8* m_Base;
+    uSys m_RunCount;
+    /**
+     *   Runs which are entirely free, only their first page is
+     * committed.
+     */
+    Run* m_FreeRuns;
+    SizeClass m_Classes[ClassCount];
+};
+
+}
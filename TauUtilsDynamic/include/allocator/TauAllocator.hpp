@@ -4,6 +4,7 @@
 #include "NumTypes.hpp"
 #include "TUConfig.hpp"
 #include "PageAllocator.hpp"
+#include "AllocationProfile.hpp"
 #include <atomic>
 #include <cassert>
 #include <memory>
@@ -103,7 +104,17 @@ enum class AllocationTracking
      * double deletion doesn't count towards the deallocation
      * count.
      */
-    DoubleDeleteCount
+    DoubleDeleteCount,
+    /**
+     *   Records the size and call site of every allocation in an
+     * `AllocationProfile`. This tracks live and peak bytes, a
+     * histogram of allocation sizes, and how much memory each call
+     * site is holding on to. Each allocation is prefixed with a 16
+     * byte header. This is supported by `BasicTauAllocator`, any
+     * other allocator can be profiled by wrapping it in a
+     * `ProfilingTauAllocator`.
+     */
+    Profile
 };
 
 extern "C" TAU_UTILS_LIB void* TauUtilsAllocateNonConst(uSys size) noexcept;
@@ -379,6 +390,103 @@ private:
     static BasicTauAllocator s_Instance;
 };
 
+template<>
+class TAU_UTILS_LIB BasicTauAllocator<AllocationTracking::Profile> final : public TauAllocator
+{
+    DEFAULT_CONSTRUCT_PI(BasicTauAllocator);
+    DEFAULT_DESTRUCT(BasicTauAllocator);
+    DELETE_CM(BasicTauAllocator);
+public:
+    static constexpr BasicTauAllocator& Instance() noexcept
+    { return s_Instance; }
+public:
+    [[nodiscard]] const AllocationProfile& Profile() const noexcept { return m_Profile; }
+
+    [[nodiscard]] void* Allocate(const uSys size) noexcept override
+    {
+        if(size > AllocationProfile::MaxSize)
+        {
+            return nullptr;
+        }
+
+        return m_Profile.Record(::TauUtilsAllocate(size + AllocationProfile::HeaderSize), size, RETURN_ADDRESS());
+    }
+
+    /**
+     * Attributes the allocation to location rather than the caller's address.
+     */
+    [[nodiscard]] void* AllocateAt(const uSys size, const ::std::source_location& location = ::std::source_location::current()) noexcept
+    {
+        if(size > AllocationProfile::MaxSize)
+        {
+            return nullptr;
+        }
+
+        return m_Profile.Record(::TauUtilsAllocate(size + AllocationProfile::HeaderSize), size, location);
+    }
+
+    void Deallocate(void* const obj) noexcept override
+    {
+        if(!obj) { return; }
+        ::TauUtilsDeallocate(m_Profile.Release(obj));
+    }
+private:
+    AllocationProfile m_Profile;
+private:
+    static BasicTauAllocator s_Instance;
+};
+
+/**
+ *   Profiles the allocations made through another allocator,
+ * see `AllocationTracking::Profile`. Each profiling allocator
+ * keeps its own profile, so wrapping the allocator given to a
+ * container attributes its memory to that container.
+ */
+class ProfilingTauAllocator final : public TauAllocator
+{
+    DEFAULT_DESTRUCT(ProfilingTauAllocator);
+    DELETE_CM(ProfilingTauAllocator);
+public:
+    ProfilingTauAllocator(TauAllocator& allocator = BasicTauAllocator<AllocationTracking::None>::Instance()) noexcept
+        : m_Allocator(allocator)
+        , m_Profile()
+    { }
+
+    [[nodiscard]] const AllocationProfile& Profile() const noexcept { return m_Profile; }
+
+    [[nodiscard]] void* Allocate(const uSys size) noexcept override
+    {
+        if(size > AllocationProfile::MaxSize)
+        {
+            return nullptr;
+        }
+
+        return m_Profile.Record(m_Allocator.Allocate(size + AllocationProfile::HeaderSize), size, RETURN_ADDRESS());
+    }
+
+    /**
+     * Attributes the allocation to location rather than the caller's address.
+     */
+    [[nodiscard]] void* AllocateAt(const uSys size, const ::std::source_location& location = ::std::source_location::current()) noexcept
+    {
+        if(size > AllocationProfile::MaxSize)
+        {
+            return nullptr;
+        }
+
+        return m_Profile.Record(m_Allocator.Allocate(size + AllocationProfile::HeaderSize), size, location);
+    }
+
+    void Deallocate(void* const obj) noexcept override
+    {
+        if(!obj) { return; }
+        m_Allocator.Deallocate(m_Profile.Release(obj));
+    }
+private:
+    TauAllocator& m_Allocator;
+    AllocationProfile m_Profile;
+};
+
 class TAU_UTILS_LIB PageTauAllocator final : public TauAllocator
 {
     DEFAULT_CONSTRUCT_PI(PageTauAllocator);
@@ -401,3 +509,4 @@ public:
 using DefaultTauAllocator = BasicTauAllocator<AllocationTracking::None>;
 using DefaultCountingTauAllocator = BasicTauAllocator<AllocationTracking::Count>;
 using DefaultDoubleDeleteTauAllocator = BasicTauAllocator<AllocationTracking::DoubleDeleteCount>;
+using DefaultProfilingTauAllocator = BasicTauAllocator<AllocationTracking::Profile>;
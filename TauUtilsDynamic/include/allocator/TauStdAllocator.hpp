@@ -0,0 +1,205 @@
+#pragma once
+
+#include "Objects.hpp"
+#include "NumTypes.hpp"
+#include "TauAllocator.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+
+namespace TauAllocatorUtils {
+
+/**
+ *   The alignment every `TauAllocator` is assumed to provide. The
+ * fixed block allocators only align their blocks to a pointer,
+ * so this is less than the guarantee of `operator new`.
+ */
+inline constexpr uSys MinimumAlignment = alignof(void*);
+
+/**
+ *   Reports an allocation failure to the standard library, when
+ * built without exceptions this aborts instead.
+ */
+[[noreturn]] inline void ThrowBadAlloc()
+{
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+    throw ::std::bad_alloc();
+#else
+    ::std::abort();
+#endif
+}
+
+/**
+ *   Allocates size bytes aligned to alignment from allocator.
+ * Allocations with more than the minimum alignment are padded,
+ * with the original pointer stored just before the returned
+ * block.
+ */
+[[nodiscard]] inline void* AllocateAligned(TauAllocator& allocator, const uSys size, const uSys alignment) noexcept
+{
+    if(alignment <= MinimumAlignment)
+    {
+        return allocator.Allocate(size);
+    }
+
+    if(size > ~static_cast<uSys>(0) - alignment - sizeof(void*))
+    {
+        return nullptr;
+    }
+
+    void* const raw = allocator.Allocate(size + alignment + sizeof(void*));
+
+    if(!raw)
+    {
+        return nullptr;
+    }
+
+    void** const aligned = reinterpret_cast<void**>(AlignTo(reinterpret_cast<uPtr>(raw) + sizeof(void*), static_cast<uPtr>(alignment)));
+    aligned[-1] = raw;
+    return aligned;
+}
+
+/**
+ * Frees a block from `AllocateAligned` with the same alignment.
+ */
+inline void DeallocateAligned(TauAllocator& allocator, void* const obj, const uSys alignment) noexcept
+{
+    if(!obj)
+    {
+        return;
+    }
+
+    if(alignment <= MinimumAlignment)
+    {
+        allocator.Deallocate(obj);
+        return;
+    }
+
+    allocator.Deallocate(static_cast<void**>(obj)[-1]);
+}
+
+}
+
+/**
+ *   Exposes a `TauAllocator` as a `std::pmr::memory_resource`,
+ * so `std::pmr` containers can allocate from it.
+ *
+ *   The allocator must be able to serve every size the container
+ * asks for, a fixed block allocator only suits node based
+ * containers whose nodes fit in its blocks. Alignments beyond
+ * `alignof(void*)` are padded.
+ *
+ *   When allocation fails this throws `std::bad_alloc`, as
+ * required of a memory resource, or aborts when exceptions are
+ * disabled.
+ */
+class TauMemoryResource final : public ::std::pmr::memory_resource
+{
+    DEFAULT_DESTRUCT(TauMemoryResource);
+    DELETE_CM(TauMemoryResource);
+public:
+    TauMemoryResource(TauAllocator& allocator = DefaultTauAllocator::Instance()) noexcept
+        : m_Allocator(&allocator)
+    { }
+
+    [[nodiscard]] TauAllocator& Allocator() const noexcept { return *m_Allocator; }
+protected:
+    [[nodiscard]] void* do_allocate(const ::std::size_t bytes, const ::std::size_t alignment) override
+    {
+        void* const allocation = TauAllocatorUtils::AllocateAligned(*m_Allocator, bytes, alignment);
+
+        if(!allocation)
+        {
+            TauAllocatorUtils::ThrowBadAlloc();
+        }
+
+        return allocation;
+    }
+
+    void do_deallocate(void* const p, const ::std::size_t bytes, const ::std::size_t alignment) override
+    {
+        (void) bytes;
+        TauAllocatorUtils::DeallocateAligned(*m_Allocator, p, alignment);
+    }
+
+    /**
+     *   Resources are only equal to themselves, this avoids relying
+     * on RTTI to compare the wrapped allocators.
+     */
+    [[nodiscard]] bool do_is_equal(const ::std::pmr::memory_resource& other) const noexcept override
+    { return this == &other; }
+private:
+    TauAllocator* m_Allocator;
+};
+
+/**
+ *   Adapts a `TauAllocator` to the standard allocator
+ * requirements, for use with containers that take an allocator
+ * type, such as `std::vector<T, TauStdAllocator<T>>`.
+ *
+ *   Copies share the underlying allocator, which must outlive
+ * every container using it. The allocator propagates with the
+ * container on copy, move and swap. Like `TauMemoryResource`
+ * this throws `std::bad_alloc` when allocation fails.
+ */
+template<typename T>
+class TauStdAllocator
+{
+    DEFAULT_DESTRUCT(TauStdAllocator);
+    DEFAULT_CM_PU(TauStdAllocator);
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = ::std::true_type;
+    using propagate_on_container_move_assignment = ::std::true_type;
+    using propagate_on_container_swap = ::std::true_type;
+    using is_always_equal = ::std::false_type;
+
+    template<typename U>
+    friend class TauStdAllocator;
+public:
+    TauStdAllocator(TauAllocator& allocator = DefaultTauAllocator::Instance()) noexcept
+        : m_Allocator(&allocator)
+    { }
+
+    template<typename U>
+    TauStdAllocator(const TauStdAllocator<U>& copy) noexcept
+        : m_Allocator(copy.m_Allocator)
+    { }
+
+    [[nodiscard]] TauAllocator& Allocator() const noexcept { return *m_Allocator; }
+
+    [[nodiscard]] T* allocate(const ::std::size_t count)
+    {
+        if(count > static_cast<::std::size_t>(-1) / sizeof(T))
+        {
+            TauAllocatorUtils::ThrowBadAlloc();
+        }
+
+        void* const allocation = TauAllocatorUtils::AllocateAligned(*m_Allocator, count * sizeof(T), alignof(T));
+
+        if(!allocation)
+        {
+            TauAllocatorUtils::ThrowBadAlloc();
+        }
+
+        return static_cast<T*>(allocation);
+    }
+
+    void deallocate(T* const p, const ::std::size_t count) noexcept
+    {
+        (void) count;
+        TauAllocatorUtils::DeallocateAligned(*m_Allocator, p, alignof(T));
+    }
+
+    template<typename U>
+    [[nodiscard]] bool operator==(const TauStdAllocator<U>& other) const noexcept
+    { return m_Allocator == other.m_Allocator; }
+
+    template<typename U>
+    [[nodiscard]] bool operator!=(const TauStdAllocator<U>& other) const noexcept
+    { return m_Allocator != other.m_Allocator; }
+private:
+    TauAllocator* m_Allocator;
+};
@@ -0,0 +1,456 @@
+#pragma once
+
+#include "Objects.hpp"
+#include "NumTypes.hpp"
+#include "TauAllocator.hpp"
+#include "FixedBlockAllocator.hpp"
+#include <atomic>
+#include <mutex>
+
+namespace tau::allocator {
+
+/**
+ *   A fixed block allocator that can be shared between threads.
+ *
+ *   Each thread keeps two magazines, small stacks of free blocks,
+ * and serves allocations and deallocations from them without
+ * taking any lock. Only once both of a thread's magazines are
+ * empty, or both are full, does it take the shared depot's lock
+ * to exchange a whole magazine. Full magazines returned by one
+ * thread are handed to threads that run dry, and the depot only
+ * carves new blocks out of the underlying `FixedBlockAllocator`
+ * when there are none to hand out. Block exchanges therefore
+ * touch the lock at most once every `MagazineSize` operations.
+ *
+ *   When a thread exits the blocks cached by it are returned to
+ * the pool. Blocks cached by threads that are still running when
+ * the allocator is destroyed are released along with the rest of
+ * the pool.
+ *
+ *   Blocks may be freed by a different thread than the one that
+ * allocated them.
+ */
+template<uSys MagazineSize = 32>
+class ThreadCachingBlockAllocator final : public TauAllocator
+{
+    DELETE_CM(ThreadCachingBlockAllocator);
+
+    static_assert(MagazineSize > 0, "MagazineSize must be at least 1.");
+private:
+    struct Magazine final
+    {
+        Magazine* Next;
+        uSys Count;
+        void* Blocks[MagazineSize];
+    };
+
+    struct ThreadCache final
+    {
+        /**
+         *   Set to null by the owning allocator when it is destroyed,
+         * the thread then only has to free the cache itself.
+         */
+        ::std::atomic<ThreadCachingBlockAllocator*> Owner;
+        ThreadCache* NextLocal;
+        ThreadCache* NextRegistered;
+        Magazine* Loaded;
+        Magazine* Previous;
+    };
+
+    /**
+     *   The caches of the current thread, one for each allocator it
+     * has used. These are released when the thread exits.
+     */
+    struct ThreadCacheList final
+    {
+        DEFAULT_CONSTRUCT_PU(ThreadCacheList);
+        DELETE_CM(ThreadCacheList);
+
+        ThreadCache* Head = nullptr;
+
+        ~ThreadCacheList() noexcept
+        {
+            ::std::lock_guard lock(RegistryMutex());
+
+            while(Head)
+            {
+                ThreadCache* const next = Head->NextLocal;
+
+                if(ThreadCachingBlockAllocator* const owner = Head->Owner.load(::std::memory_order_relaxed))
+                {
+                    owner->ReleaseCache(Head);
+                }
+
+                DefaultTauAllocator::Instance().DeallocateT(Head);
+                Head = next;
+            }
+        }
+    };
+public:
+    ThreadCachingBlockAllocator(const uSys blockSize, const PageCountVal numReservedPages = static_cast<PageCountVal>(1024), const uSys allocPages = 4, TauAllocator& magazineAllocator = DefaultTauAllocator::Instance()) noexcept
+        : m_Pool(blockSize, numReservedPages, allocPages)
+        , m_MagazineAllocator(&magazineAllocator)
+        , m_DepotMutex()
+        , m_FullMagazines(nullptr)
+        , m_EmptyMagazines(nullptr)
+        , m_Registered(nullptr)
+    { }
+
+    ThreadCachingBlockAllocator(const uSys blockSize, const uSys maxElements, const uSys allocPages = 4, TauAllocator& magazineAllocator = DefaultTauAllocator::Instance()) noexcept
+        : m_Pool(blockSize, maxElements, allocPages)
+        , m_MagazineAllocator(&magazineAllocator)
+        , m_DepotMutex()
+        , m_FullMagazines(nullptr)
+        , m_EmptyMagazines(nullptr)
+        , m_Registered(nullptr)
+    { }
+
+    ~ThreadCachingBlockAllocator() noexcept override
+    {
+        {
+            ::std::lock_guard lock(RegistryMutex());
+
+            for(ThreadCache* cache = m_Registered; cache; cache = cache->NextRegistered)
+            {
+                cache->Owner.store(nullptr, ::std::memory_order_relaxed);
+                m_MagazineAllocator->DeallocateT(cache->Loaded);
+                m_MagazineAllocator->DeallocateT(cache->Previous);
+            }
+        }
+
+        FreeMagazines(m_FullMagazines);
+        FreeMagazines(m_EmptyMagazines);
+    }
+
+    [[nodiscard]] uSys BlockSize() const noexcept { return m_Pool.blockSize(); }
+
+    [[nodiscard]] void* Allocate(const uSys size) noexcept override
+    {
+        if(size > m_Pool.blockSize())
+        {
+            return nullptr;
+        }
+
+        ThreadCache* const cache = LocalCache();
+
+        if(!cache)
+        {
+            ::std::lock_guard lock(m_DepotMutex);
+            return m_Pool.allocate();
+        }
+
+        if(cache->Loaded->Count == 0)
+        {
+            if(cache->Previous->Count == 0)
+            {
+                return AllocateSlow(*cache);
+            }
+
+            ::std::swap(cache->Loaded, cache->Previous);
+        }
+
+        return cache->Loaded->Blocks[--cache->Loaded->Count];
+    }
+
+    void Deallocate(void* const obj) noexcept override
+    {
+        if(!obj)
+        {
+            return;
+        }
+
+        ThreadCache* const cache = LocalCache();
+
+        if(!cache)
+        {
+            ::std::lock_guard lock(m_DepotMutex);
+            m_Pool.Deallocate(obj);
+            return;
+        }
+
+        if(cache->Loaded->Count == MagazineSize)
+        {
+            if(cache->Previous->Count == MagazineSize)
+            {
+                DeallocateSlow(*cache, obj);
+                return;
+            }
+
+            ::std::swap(cache->Loaded, cache->Previous);
+        }
+
+        cache->Loaded->Blocks[cache->Loaded->Count++] = obj;
+    }
+
+    /**
+     *   Returns every block cached by the calling thread to the
+     * shared pool. Threads which are about to go idle for a long
+     * time can use this to make their blocks available to others.
+     */
+    void FlushThreadCache() noexcept
+    {
+        for(ThreadCache* cache = LocalCaches().Head; cache; cache = cache->NextLocal)
+        {
+            if(cache->Owner.load(::std::memory_order_relaxed) == this)
+            {
+                ::std::lock_guard lock(m_DepotMutex);
+                ReturnBlocks(*cache->Loaded);
+                ReturnBlocks(*cache->Previous);
+                return;
+            }
+        }
+    }
+private:
+    /**
+     *   Both magazines are empty. Swap an empty magazine for a full
+     * one from the depot, or refill from the pool if there are
+     * none.
+     */
+    [[nodiscard]] void* AllocateSlow(ThreadCache& cache) noexcept
+    {
+        ::std::lock_guard lock(m_DepotMutex);
+
+        if(m_FullMagazines)
+        {
+            Magazine* const full = m_FullMagazines;
+            m_FullMagazines = full->Next;
+
+            cache.Previous->Next = m_EmptyMagazines;
+            m_EmptyMagazines = cache.Previous;
+            cache.Previous = cache.Loaded;
+            cache.Loaded = full;
+        }
+        else
+        {
+            Magazine& loaded = *cache.Loaded;
+
+            for(; loaded.Count < MagazineSize; ++loaded.Count)
+            {
+                void* const block = m_Pool.allocate();
+
+                if(!block)
+                {
+                    break;
+                }
+
+                loaded.Blocks[loaded.Count] = block;
+            }
+
+            if(loaded.Count == 0)
+            {
+                return nullptr;
+            }
+        }
+
+        return cache.Loaded->Blocks[--cache.Loaded->Count];
+    }
+
+    /**
+     *   Both magazines are full. Hand the full previous magazine to
+     * the depot and continue with an empty one.
+     */
+    void DeallocateSlow(ThreadCache& cache, void* const obj) noexcept
+    {
+        {
+            ::std::lock_guard lock(m_DepotMutex);
+
+            Magazine* empty = m_EmptyMagazines;
+
+            if(empty)
+            {
+                m_EmptyMagazines = empty->Next;
+            }
+            else
+            {
+                empty = AllocateMagazine();
+
+                if(!empty)
+                {
+                    m_Pool.Deallocate(obj);
+                    return;
+                }
+            }
+
+            cache.Previous->Next = m_FullMagazines;
+            m_FullMagazines = cache.Previous;
+            cache.Previous = cache.Loaded;
+            cache.Loaded = empty;
+        }
+
+        cache.Loaded->Blocks[cache.Loaded->Count++] = obj;
+    }
+
+    [[nodiscard]] ThreadCache* LocalCache() noexcept
+    {
+        ThreadCacheList& list = LocalCaches();
+
+        if(list.Head && list.Head->Owner.load(::std::memory_order_relaxed) == this)
+        {
+            return list.Head;
+        }
+
+        return FindOrCreateCache(list);
+    }
+
+    /**
+     *   Searches the thread's caches for this allocator, moving it to
+     * the front of the list. Caches of destroyed allocators are
+     * pruned along the way.
+     */
+    [[nodiscard]] ThreadCache* FindOrCreateCache(ThreadCacheList& list) noexcept
+    {
+        ThreadCache* found = nullptr;
+        ThreadCache** link = &list.Head;
+
+        while(*link)
+        {
+            ThreadCache* const cache = *link;
+            ThreadCachingBlockAllocator* const owner = cache->Owner.load(::std::memory_order_relaxed);
+
+            if(owner == this)
+            {
+                *link = cache->NextLocal;
+                found = cache;
+            }
+            else if(!owner)
+            {
+                *link = cache->NextLocal;
+                DefaultTauAllocator::Instance().DeallocateT(cache);
+            }
+            else
+            {
+                link = &cache->NextLocal;
+            }
+        }
+
+        if(!found)
+        {
+            found = CreateCache();
+
+            if(!found)
+            {
+                return nullptr;
+            }
+        }
+
+        found->NextLocal = list.Head;
+        list.Head = found;
+        return found;
+    }
+
+    [[nodiscard]] ThreadCache* CreateCache() noexcept
+    {
+        ThreadCache* const cache = DefaultTauAllocator::Instance().AllocateT<ThreadCache>();
+
+        if(!cache)
+        {
+            return nullptr;
+        }
+
+        {
+            ::std::lock_guard lock(m_DepotMutex);
+            cache->Loaded = AllocateMagazine();
+            cache->Previous = AllocateMagazine();
+        }
+
+        if(!cache->Loaded || !cache->Previous)
+        {
+            m_MagazineAllocator->DeallocateT(cache->Loaded);
+            m_MagazineAllocator->DeallocateT(cache->Previous);
+            DefaultTauAllocator::Instance().DeallocateT(cache);
+            return nullptr;
+        }
+
+        cache->Owner.store(this, ::std::memory_order_relaxed);
+        cache->NextLocal = nullptr;
+
+        ::std::lock_guard lock(RegistryMutex());
+        cache->NextRegistered = m_Registered;
+        m_Registered = cache;
+
+        return cache;
+    }
+
+    /**
+     *   Called with the registry lock held when a thread exits.
+     */
+    void ReleaseCache(ThreadCache* const cache) noexcept
+    {
+        for(ThreadCache** link = &m_Registered; *link; link = &(*link)->NextRegistered)
+        {
+            if(*link == cache)
+            {
+                *link = cache->NextRegistered;
+                break;
+            }
+        }
+
+        ::std::lock_guard lock(m_DepotMutex);
+
+        ReturnBlocks(*cache->Loaded);
+        ReturnBlocks(*cache->Previous);
+
+        cache->Loaded->Next = cache->Previous;
+        cache->Previous->Next = m_EmptyMagazines;
+        m_EmptyMagazines = cache->Loaded;
+    }
+
+    void ReturnBlocks(Magazine& magazine) noexcept
+    {
+        for(uSys i = 0; i < magazine.Count; ++i)
+        {
+            m_Pool.Deallocate(magazine.Blocks[i]);
+        }
+
+        magazine.Count = 0;
+    }
+
+    [[nodiscard]] Magazine* AllocateMagazine() noexcept
+    {
+        Magazine* const magazine = m_MagazineAllocator->AllocateT<Magazine>();
+
+        if(magazine)
+        {
+            magazine->Next = nullptr;
+            magazine->Count = 0;
+        }
+
+        return magazine;
+    }
+
+    void FreeMagazines(Magazine* magazine) noexcept
+    {
+        while(magazine)
+        {
+            Magazine* const next = magazine->Next;
+            m_MagazineAllocator->DeallocateT(magazine);
+            magazine = next;
+        }
+    }
+
+    [[nodiscard]] static ThreadCacheList& LocalCaches() noexcept
+    {
+        static thread_local ThreadCacheList caches;
+        return caches;
+    }
+
+    /**
+     *   Guards registering caches with their allocator. This is held
+     * across a thread exiting and an allocator being destroyed, so
+     * neither can see the other half torn down.
+     */
+    [[nodiscard]] static ::std::mutex& RegistryMutex() noexcept
+    {
+        static ::std::mutex mutex;
+        return mutex;
+    }
+private:
+    FixedBlockAllocator<AllocationTracking::None> m_Pool;
+    TauAllocator* m_MagazineAllocator;
+    ::std::mutex m_DepotMutex;
+    Magazine* m_FullMagazines;
+    Magazine* m_EmptyMagazines;
+    ThreadCache* m_Registered;
+};
+
+}
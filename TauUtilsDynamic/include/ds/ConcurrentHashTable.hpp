@@ -0,0 +1,399 @@
+#pragma once
+
+#include "Objects.hpp"
+#include "NumTypes.hpp"
+#include "allocator/TauAllocator.hpp"
+#include "HashTable.hpp"
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+namespace tau {
+
+/**
+ *   A hash table which is safe to use from multiple threads.
+ *
+ *   The key space is split into `ShardCount` shards, each of
+ * which is an independent `HashTable` using Robin Hood probing.
+ * Writers to a shard are serialized by that shard's sequence
+ * lock, writers to different shards never contend.
+ *
+ *   When both the key and value are trivially copyable, reads
+ * never take a lock. A reader records the shard's sequence
+ * number, performs the lookup and copies the value out, then
+ * retries if a writer touched the shard in the meantime. To
+ * keep this safe while a writer grows the shard, bucket arrays
+ * released by a shard are retired rather than freed, and are
+ * only returned to the allocator by `Reclaim` or when the table
+ * is destroyed. Robin Hood probing never leaves tombstones, so
+ * a shard only rehashes when it grows, which bounds the retired
+ * memory to less than the live bucket array. For any other key
+ * or value types reads take the shard's lock.
+ *
+ *   Insert replaces the value of an existing key.
+ */
+template<typename KeyT, typename ValueT, typename CapacityPolicyT = PowerOfTwoCapacityPolicy, uSys ShardCount = 64>
+class ConcurrentHashTable final
+{
+    DELETE_CM(ConcurrentHashTable);
+
+    static_assert(::std::has_single_bit(ShardCount), "ShardCount must be a power of two.");
+private:
+    using Table_t = HashTable<KeyT, ValueT, CapacityPolicyT, RobinHoodProbePolicy>;
+    using Bucket_t = typename Table_t::Bucket_t;
+    using BucketArr_t = typename Table_t::BucketArr_t;
+
+    static constexpr bool IsOptimisticRead = ::std::is_trivially_copyable_v<KeyT> && ::std::is_trivially_copyable_v<ValueT>;
+
+    static constexpr uSys CacheLineSize = 64;
+    static constexpr uSys ShardBits = static_cast<uSys>(::std::countr_zero(ShardCount));
+    /**
+     *   Shards are picked using a different multiplier than the
+     * power of two home bucket, so the bits selecting a shard
+     * aren't correlated with the bits selecting a bucket within
+     * that shard.
+     */
+    static constexpr uSys ShardMultiplier = sizeof(uSys) == 8 ? static_cast<uSys>(0xC2B2AE3D27D4EB4Full) : static_cast<uSys>(0x85EBCA6Bu);
+
+    /**
+     *   Passes allocations through to another allocator, but holds
+     * onto deallocations until they are explicitly reclaimed.
+     *
+     *   This is only ever accessed while holding the owning shard's
+     * lock.
+     */
+    class RetiringAllocator final : public TauAllocator
+    {
+        DELETE_CM(RetiringAllocator);
+    private:
+        struct RetiredNode final
+        {
+            RetiredNode* Next;
+            void* Allocation;
+        };
+    public:
+        RetiringAllocator(TauAllocator& allocator) noexcept
+            : m_Allocator(&allocator)
+            , m_Retired(nullptr)
+        { }
+
+        ~RetiringAllocator() noexcept override
+        {
+            Reclaim();
+        }
+
+        [[nodiscard]] void* Allocate(const uSys size) noexcept override
+        { return m_Allocator->Allocate(size); }
+
+        void Deallocate(void* const obj) noexcept override
+        {
+            if(!obj)
+            {
+                return;
+            }
+
+            RetiredNode* const node = m_Allocator->AllocateT<RetiredNode>(m_Retired, obj);
+
+            // If we can't track the allocation it has to be leaked, a reader may still be using it.
+            if(node)
+            {
+                m_Retired = node;
+            }
+        }
+
+        void Reclaim() noexcept
+        {
+            while(m_Retired)
+            {
+                RetiredNode* const next = m_Retired->Next;
+                m_Allocator->Deallocate(m_Retired->Allocation);
+                m_Allocator->DeallocateT(m_Retired);
+                m_Retired = next;
+            }
+        }
+    private:
+        TauAllocator* m_Allocator;
+        RetiredNode* m_Retired;
+    };
+
+    struct alignas(CacheLineSize) Shard final
+    {
+        DEFAULT_DESTRUCT(Shard);
+        DELETE_CM(Shard);
+
+        /**
+         *   Odd while a writer holds the shard. Readers retry if this
+         * changed while they were reading.
+         */
+        ::std::atomic<uSys> Sequence;
+        ::std::atomic<uSys> Count;
+        RetiringAllocator ArrayAllocator;
+        RetiringAllocator NodeAllocator;
+        Table_t Table;
+
+        Shard(const uSys minCount, TauAllocator& arrayAllocator, TauAllocator& nodeAllocator) noexcept
+            : Sequence(0)
+            , Count(0)
+            , ArrayAllocator(arrayAllocator)
+            , NodeAllocator(nodeAllocator)
+            , Table(minCount, ArrayAllocator, NodeAllocator)
+        { }
+    };
+private:
+    alignas(Shard) u8 m_ShardBuffer[sizeof(Shard) * ShardCount];
+public:
+    ConcurrentHashTable(
+        const uSys minCount = 1,
+        TauAllocator& arrayAllocator = DefaultTauAllocator::Instance(),
+        TauAllocator& nodeAllocator = DefaultTauAllocator::Instance()
+    ) noexcept
+        : m_ShardBuffer { }
+    {
+        const uSys shardMinCount = DivCeil(minCount, ShardCount);
+
+        for(uSys i = 0; i < ShardCount; ++i)
+        {
+            (void) ::std::construct_at(&Shards()[i], shardMinCount, arrayAllocator, nodeAllocator);
+        }
+    }
+
+    ~ConcurrentHashTable() noexcept
+    {
+        ::std::destroy_n(Shards(), ShardCount);
+    }
+
+    /**
+     *   The number of elements in the table. While other threads are
+     * writing this is only a snapshot.
+     */
+    [[nodiscard]] uSys Count() const noexcept
+    {
+        uSys count = 0;
+
+        for(uSys i = 0; i < ShardCount; ++i)
+        {
+            count += Shards()[i].Count.load(::std::memory_order_relaxed);
+        }
+
+        return count;
+    }
+
+    void Insert(const KeyT& key, const ValueT& value) noexcept
+    {
+        Shard& shard = FindShard(key);
+        LockShard(shard);
+
+        if(ValueT* const existing = shard.Table.Get(key))
+        {
+            *existing = value;
+        }
+        else
+        {
+            shard.Table.Insert(key, value);
+            shard.Count.store(shard.Table.Count(), ::std::memory_order_relaxed);
+        }
+
+        UnlockShard(shard);
+    }
+
+    void Insert(const KeyT& key, ValueT&& value) noexcept
+    {
+        Shard& shard = FindShard(key);
+        LockShard(shard);
+
+        if(ValueT* const existing = shard.Table.Get(key))
+        {
+            *existing = ::std::move(value);
+        }
+        else
+        {
+            shard.Table.Insert(key, ::std::move(value));
+            shard.Count.store(shard.Table.Count(), ::std::memory_order_relaxed);
+        }
+
+        UnlockShard(shard);
+    }
+
+    /**
+     *   Removes the entry for key, destroying both the key and the
+     * value.
+     *
+     * @return
+     *      Whether the key was present.
+     */
+    bool Remove(const KeyT& key) noexcept
+    {
+        Shard& shard = FindShard(key);
+        LockShard(shard);
+
+        const bool removed = shard.Table.Remove(key);
+        shard.Count.store(shard.Table.Count(), ::std::memory_order_relaxed);
+
+        UnlockShard(shard);
+
+        return removed;
+    }
+
+    [[nodiscard]] bool Contains(const KeyT& key) const noexcept
+    {
+        return Find(key, nullptr);
+    }
+
+    /**
+     *   Copies the value for key into value.
+     *
+     * @return
+     *      Whether the key was present, value is left untouched if
+     *    it wasn't.
+     */
+    [[nodiscard]] bool TryGet(const KeyT& key, ValueT& value) const noexcept
+    {
+        return Find(key, &value);
+    }
+
+    /**
+     *   Frees the bucket arrays retired by shards that have grown.
+     *
+     *   This must only be called while no other thread is using the
+     * table.
+     */
+    void Reclaim() noexcept
+    {
+        for(uSys i = 0; i < ShardCount; ++i)
+        {
+            Shards()[i].ArrayAllocator.Reclaim();
+            Shards()[i].NodeAllocator.Reclaim();
+        }
+    }
+private:
+    [[nodiscard]] bool Find(const KeyT& key, ValueT* const value) const noexcept
+    {
+        const uSys hashCode = Bucket_t::AdjustHashCode(::std::hash<KeyT> {}(key));
+        Shard& shard = const_cast<Shard&>(Shards()[ShardIndex(hashCode)]);
+
+        if constexpr(IsOptimisticRead)
+        {
+            alignas(ValueT) u8 valueBuffer[sizeof(ValueT)];
+
+            while(true)
+            {
+                const uSys sequence = ReadBegin(shard);
+
+                const BucketArr_t buckets = ::std::atomic_ref<BucketArr_t>(shard.Table.m_Buckets).load(::std::memory_order_relaxed);
+                const uSys bucketCountIndex = ::std::atomic_ref<uSys>(shard.Table.m_BucketCountIndex).load(::std::memory_order_relaxed);
+                const uSys bucketCount = ::std::atomic_ref<uSys>(shard.Table.m_BucketCount).load(::std::memory_order_relaxed);
+
+                // The bucket array and its size must come from the same version of the shard before we walk it.
+                if(!ReadValidate(shard, sequence))
+                {
+                    continue;
+                }
+
+                const uSys hashIndex = Table_t::FindIndex(key, hashCode, buckets, bucketCountIndex, bucketCount);
+                const bool found = hashIndex != Table_t::InvalidIndex;
+
+                if(found && value)
+                {
+                    (void) ::std::memcpy(valueBuffer, Table_t::DeReference(buckets[hashIndex]).ValuePtr(), sizeof(ValueT));
+                }
+
+                if(ReadValidate(shard, sequence))
+                {
+                    if(found && value)
+                    {
+                        (void) ::std::memcpy(value, valueBuffer, sizeof(ValueT));
+                    }
+
+                    return found;
+                }
+            }
+        }
+        else
+        {
+            LockShard(shard);
+
+            const ValueT* const found = shard.Table.Get(key);
+
+            if(found && value)
+            {
+                *value = *found;
+            }
+
+            UnlockShard(shard);
+
+            return found;
+        }
+    }
+
+    [[nodiscard]] Shard& FindShard(const KeyT& key) noexcept
+    {
+        return Shards()[ShardIndex(Bucket_t::AdjustHashCode(::std::hash<KeyT> {}(key)))];
+    }
+
+    [[nodiscard]] static uSys ShardIndex(const uSys hashCode) noexcept
+    {
+        if constexpr(ShardBits == 0)
+        {
+            (void) hashCode;
+            return 0;
+        }
+        else
+        {
+            return (hashCode * ShardMultiplier) >> (sizeof(uSys) * 8 - ShardBits);
+        }
+    }
+
+    static void LockShard(Shard& shard) noexcept
+    {
+        uSys sequence = shard.Sequence.load(::std::memory_order_relaxed);
+
+        while(true)
+        {
+            if((sequence & 1) == 0 && shard.Sequence.compare_exchange_weak(sequence, sequence + 1, ::std::memory_order_acquire, ::std::memory_order_relaxed))
+            {
+                break;
+            }
+
+            ::std::this_thread::yield();
+            sequence = shard.Sequence.load(::std::memory_order_relaxed);
+        }
+
+        // Don't let any writes to the table become visible before the sequence is odd.
+        ::std::atomic_thread_fence(::std::memory_order_release);
+    }
+
+    static void UnlockShard(Shard& shard) noexcept
+    {
+        (void) shard.Sequence.fetch_add(1, ::std::memory_order_release);
+    }
+
+    [[nodiscard]] static uSys ReadBegin(const Shard& shard) noexcept
+    {
+        while(true)
+        {
+            const uSys sequence = shard.Sequence.load(::std::memory_order_acquire);
+
+            if((sequence & 1) == 0)
+            {
+                return sequence;
+            }
+
+            ::std::this_thread::yield();
+        }
+    }
+
+    [[nodiscard]] static bool ReadValidate(const Shard& shard, const uSys sequence) noexcept
+    {
+        ::std::atomic_thread_fence(::std::memory_order_acquire);
+        return shard.Sequence.load(::std::memory_order_relaxed) == sequence;
+    }
+
+    [[nodiscard]]       Shard* Shards()       noexcept { return reinterpret_cast<      Shard*>(m_ShardBuffer); }
+    [[nodiscard]] const Shard* Shards() const noexcept { return reinterpret_cast<const Shard*>(m_ShardBuffer); }
+};
+
+}
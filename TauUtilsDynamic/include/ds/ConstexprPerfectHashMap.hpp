@@ -0,0 +1,308 @@
+#pragma once
+
+#include "Objects.hpp"
+#include "NumTypes.hpp"
+#include "String.hpp"
+#include <array>
+#include <bit>
+
+namespace tau {
+
+template<typename Char, typename ValueT>
+struct PerfectHashEntry final
+{
+    const Char* Key;
+    ValueT Value;
+};
+
+/**
+ *   A read only map from strings to values, built entirely at
+ * compile time from a fixed set of keys.
+ *
+ *   The table uses hash and displace perfect hashing. Keys are
+ * hashed with a seeded 64 bit hash, the top bits of which pick a
+ * bucket. Each bucket stores a displacement that was chosen at
+ * compile time so that every key maps to its own slot. A lookup
+ * costs one pass over the key to hash it, then a single slot is
+ * compared, there is no probing and no startup cost. Declaring
+ * the map `constexpr` places the whole table in read only data.
+ *
+ *   Construction fails to compile if a key is duplicated.
+ *
+ *   Use `MakePerfectHashMap` to deduce the entry count:
+ *
+ *     static constexpr auto Keywords = ::tau::MakePerfectHashMap<c8, int>({
+ *         { u8"if", 0 },
+ *         { u8"else", 1 },
+ *     });
+ */
+template<typename Char, typename ValueT, uSys EntryCount>
+class ConstexprPerfectHashMap final
+{
+    static_assert(EntryCount > 0, "A perfect hash map must have at least one entry.");
+public:
+    using Entry = PerfectHashEntry<Char, ValueT>;
+
+    /**
+     *   Slots are kept at a load factor of at most 80% so that
+     * displacements are quick to find.
+     */
+    static constexpr uSys SlotCount = ::std::bit_ceil(EntryCount + EntryCount / 4 + 1);
+    static constexpr uSys BucketCount = ::std::bit_ceil(EntryCount / 4 + 1);
+private:
+    static constexpr u32 BucketBits = static_cast<u32>(::std::countr_zero(BucketCount));
+    static constexpr u32 MaxDisplacement = 1u << 16;
+    static constexpr u32 MaxSeedAttempts = 64;
+
+    struct Slot final
+    {
+        const Char* Key;
+        uSys Length;
+        ValueT Value;
+    };
+private:
+    u64 m_Seed;
+    ::std::array<u32, BucketCount> m_Displacements;
+    ::std::array<Slot, SlotCount> m_Slots;
+public:
+    consteval ConstexprPerfectHashMap(const Entry (&entries)[EntryCount]) noexcept
+        : m_Seed(0)
+        , m_Displacements { }
+        , m_Slots { }
+    {
+        for(u32 attempt = 0; attempt < MaxSeedAttempts; ++attempt)
+        {
+            if(TryBuild(entries, Mix(attempt + 1)))
+            {
+                return;
+            }
+        }
+
+        // Not a constant expression, so this surfaces as a compile error.
+        throw "ConstexprPerfectHashMap could not be built, check for duplicate keys.";
+    }
+
+    [[nodiscard]] static constexpr uSys Count() noexcept { return EntryCount; }
+
+    [[nodiscard]] constexpr const ValueT* Get(const Char* const key) const noexcept
+    {
+        uSys length = 0;
+        const u64 hashCode = HashTerminated(key, length, m_Seed);
+        return Find(key, length, hashCode);
+    }
+
+    [[nodiscard]] constexpr const ValueT* Get(const Char* const key, const uSys length) const noexcept
+    {
+        return Find(key, length, Hash(key, length, m_Seed));
+    }
+
+    [[nodiscard]] const ValueT* Get(const StringBaseT<Char>& key) const noexcept
+    {
+        return Get(key.String(), key.Length());
+    }
+
+    [[nodiscard]] constexpr bool Contains(const Char* const key) const noexcept
+    { return Get(key); }
+
+    [[nodiscard]] constexpr bool Contains(const Char* const key, const uSys length) const noexcept
+    { return Get(key, length); }
+
+    [[nodiscard]] bool Contains(const StringBaseT<Char>& key) const noexcept
+    { return Get(key); }
+private:
+    [[nodiscard]] constexpr const ValueT* Find(const Char* const key, const uSys length, const u64 hashCode) const noexcept
+    {
+        const Slot& slot = m_Slots[SlotIndex(hashCode, m_Displacements[BucketIndex(hashCode)])];
+
+        if(!slot.Key || slot.Length != length)
+        {
+            return nullptr;
+        }
+
+        for(uSys i = 0; i < length; ++i)
+        {
+            if(slot.Key[i] != key[i])
+            {
+                return nullptr;
+            }
+        }
+
+        return &slot.Value;
+    }
+
+    consteval bool TryBuild(const Entry (&entries)[EntryCount], const u64 seed) noexcept
+    {
+        u64 hashCodes[EntryCount] { };
+        uSys lengths[EntryCount] { };
+
+        for(uSys i = 0; i < EntryCount; ++i)
+        {
+            hashCodes[i] = HashTerminated(entries[i].Key, lengths[i], seed);
+
+            // Keys with identical hash codes can never be separated by a displacement.
+            for(uSys j = 0; j < i; ++j)
+            {
+                if(hashCodes[i] == hashCodes[j])
+                {
+                    return false;
+                }
+            }
+        }
+
+        uSys bucketSizes[BucketCount] { };
+
+        for(uSys i = 0; i < EntryCount; ++i)
+        {
+            ++bucketSizes[BucketIndex(hashCodes[i])];
+        }
+
+        bool slotUsed[SlotCount] { };
+        uSys bucketSlots[EntryCount] { };
+
+        // Place the largest buckets first while there are still plenty of free slots.
+        for(uSys bucketSize = EntryCount; bucketSize > 0; --bucketSize)
+        {
+            for(uSys bucket = 0; bucket < BucketCount; ++bucket)
+            {
+                if(bucketSizes[bucket] != bucketSize)
+                {
+                    continue;
+                }
+
+                if(!PlaceBucket(hashCodes, bucket, slotUsed, bucketSlots))
+                {
+                    return false;
+                }
+            }
+        }
+
+        m_Seed = seed;
+
+        for(uSys i = 0; i < EntryCount; ++i)
+        {
+            const uSys slotIndex = SlotIndex(hashCodes[i], m_Displacements[BucketIndex(hashCodes[i])]);
+            m_Slots[slotIndex] = Slot { entries[i].Key, lengths[i], entries[i].Value };
+        }
+
+        return true;
+    }
+
+    /**
+     *   Finds the first displacement which moves every key of the
+     * bucket into a free slot, and marks those slots used.
+     */
+    consteval bool PlaceBucket(const u64 (&hashCodes)[EntryCount], const uSys bucket, bool (&slotUsed)[SlotCount], uSys (&bucketSlots)[EntryCount]) noexcept
+    {
+        for(u32 displacement = 0; displacement < MaxDisplacement; ++displacement)
+        {
+            uSys placedCount = 0;
+            bool fits = true;
+
+            for(uSys i = 0; i < EntryCount && fits; ++i)
+            {
+                if(BucketIndex(hashCodes[i]) != bucket)
+                {
+                    continue;
+                }
+
+                const uSys slotIndex = SlotIndex(hashCodes[i], displacement);
+
+                if(slotUsed[slotIndex])
+                {
+                    fits = false;
+                }
+
+                for(uSys j = 0; j < placedCount && fits; ++j)
+                {
+                    if(bucketSlots[j] == slotIndex)
+                    {
+                        fits = false;
+                    }
+                }
+
+                bucketSlots[placedCount++] = slotIndex;
+            }
+
+            if(fits)
+            {
+                for(uSys i = 0; i < placedCount; ++i)
+                {
+                    slotUsed[bucketSlots[i]] = true;
+                }
+
+                m_Displacements[bucket] = displacement;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] static constexpr uSys BucketIndex(const u64 hashCode) noexcept
+    {
+        if constexpr(BucketBits == 0)
+        {
+            (void) hashCode;
+            return 0;
+        }
+        else
+        {
+            return static_cast<uSys>(hashCode >> (64 - BucketBits));
+        }
+    }
+
+    [[nodiscard]] static constexpr uSys SlotIndex(const u64 hashCode, const u32 displacement) noexcept
+    {
+        return static_cast<uSys>(Mix(hashCode + displacement * 0x9E3779B97F4A7C15ull)) & (SlotCount - 1);
+    }
+
+    /**
+     *   Hashes a null terminated string, storing its length.
+     */
+    [[nodiscard]] static constexpr u64 HashTerminated(const Char* const key, uSys& length, const u64 seed) noexcept
+    {
+        u64 hashCode = seed;
+        uSys i = 0;
+
+        for(; key[i]; ++i)
+        {
+            hashCode = (hashCode ^ static_cast<u64>(key[i])) * 0x100000001B3ull;
+        }
+
+        length = i;
+        return Mix(hashCode ^ i);
+    }
+
+    [[nodiscard]] static constexpr u64 Hash(const Char* const key, const uSys length, const u64 seed) noexcept
+    {
+        u64 hashCode = seed;
+
+        for(uSys i = 0; i < length; ++i)
+        {
+            hashCode = (hashCode ^ static_cast<u64>(key[i])) * 0x100000001B3ull;
+        }
+
+        return Mix(hashCode ^ length);
+    }
+
+    /**
+     * The 64 bit finalizer from MurmurHash3.
+     */
+    [[nodiscard]] static constexpr u64 Mix(u64 x) noexcept
+    {
+        x ^= x >> 33;
+        x *= 0xFF51AFD7ED558CCDull;
+        x ^= x >> 33;
+        x *= 0xC4CEB9FE1A85EC53ull;
+        x ^= x >> 33;
+        return x;
+    }
+};
+
+template<typename Char, typename ValueT, uSys EntryCount>
+[[nodiscard]] consteval ConstexprPerfectHashMap<Char, ValueT, EntryCount> MakePerfectHashMap(const PerfectHashEntry<Char, ValueT> (&entries)[EntryCount]) noexcept
+{
+    return ConstexprPerfectHashMap<Char, ValueT, EntryCount>(entries);
+}
+
+}
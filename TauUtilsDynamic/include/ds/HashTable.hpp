@@ -2,54 +2,81 @@
 
 #include "Objects.hpp"
 #include "NumTypes.hpp"
+#include "TauMacros.hpp"
+#include "TUMaths.hpp"
 #include "allocator/TauAllocator.hpp"
+#include "HashTableStats.hpp"
+#include <algorithm>
+#include <cassert>
 #include <functional>
+#include <span>
 #include <unordered_map>
 #include <type_traits>
+#include "String.hpp"
 #include "ConPrinter.hpp"
 
 namespace tau {
 
 template<typename KeyT, typename ValueT>
-struct HashBucket final
+struct HashBucket
 {
     DEFAULT_DESTRUCT(HashBucket);
     DEFAULT_CM_PU(HashBucket);
 
-    static constexpr uSys TombstoneValue = 0x12AB34CD12AB34CD_uz;
+    /**
+     *   The hash code of a bucket that has never held a value,
+     * probing stops at these.
+     */
+    static constexpr uSys EmptyValue = static_cast<uSys>(0x12AB34CD12AB34CDull);
+    /**
+     *   The hash code of a bucket whose value has been removed.
+     * Probing continues past these, but insertion may reuse
+     * them.
+     */
+    static constexpr uSys DeletedValue = EmptyValue + 1;
 
     uSys HashCode;
-    u8 KeyBuffer[sizeof(KeyT)];
-    u8 ValueBuffer[sizeof(ValueT)];
+    alignas(KeyT) u8 KeyBuffer[sizeof(KeyT)];
+    alignas(ValueT) u8 ValueBuffer[sizeof(ValueT)];
 
     HashBucket() noexcept
-        : HashCode(TombstoneValue)
+        : HashCode(EmptyValue)
         , KeyBuffer { }
         , ValueBuffer { }
     { }
 
     template<typename... Args>
     HashBucket(const KeyT& key, Args&& ...args) noexcept
-        : HashCode(0)
+        : HashCode(AdjustHashCode(::std::hash<KeyT> {}(key)))
         , KeyBuffer { }
         , ValueBuffer { }
     {
-
         ::std::construct_at(KeyPtr(), key);
         ::std::construct_at(ValuePtr(), ::std::forward<Args>(args)...);
-        HashCode = ::std::hash<KeyT> {}(key);
     }
 
     template<typename... Args>
     HashBucket(KeyT&& key, Args&& ...args) noexcept
-        : HashCode(0)
+        : HashCode(AdjustHashCode(::std::hash<KeyT> {}(key)))
         , KeyBuffer { }
         , ValueBuffer { }
     {
-
         ::std::construct_at(KeyPtr(), ::std::move(key));
         ::std::construct_at(ValuePtr(), ::std::forward<Args>(args)...);
-        HashCode = ::std::hash<KeyT> {}(key);
+    }
+
+    /**
+     *   Moves hash codes which collide with the empty and deleted
+     * sentinels out of the way. Lookups must compare against
+     * the adjusted hash code.
+     */
+    [[nodiscard]] static constexpr uSys AdjustHashCode(const uSys hashCode) noexcept
+    { return hashCode - EmptyValue < 2 ? hashCode + 2 : hashCode; }
+
+    void Destroy() noexcept
+    {
+        ::std::destroy_at(KeyPtr());
+        ::std::destroy_at(ValuePtr());
     }
 
     constexpr       KeyT* KeyPtr()       noexcept { return reinterpret_cast<      KeyT*>(KeyBuffer); }
@@ -59,10 +86,48 @@ struct HashBucket final
     constexpr const ValueT* ValuePtr() const noexcept { return reinterpret_cast<const ValueT*>(ValueBuffer); }
 };
 
+/**
+ *   A hash bucket which also records how many buckets it sits
+ * past its home bucket. This is used by the linear probing
+ * policies to end lookups early and to shift entries back on
+ * removal without recomputing home buckets.
+ */
 template<typename KeyT, typename ValueT>
-class HashTable final
+struct ProbeDistanceHashBucket final : public HashBucket<KeyT, ValueT>
+{
+    DEFAULT_DESTRUCT(ProbeDistanceHashBucket);
+    DEFAULT_CM_PU(ProbeDistanceHashBucket);
+
+    uSys ProbeDistance;
+
+    ProbeDistanceHashBucket() noexcept
+        : HashBucket<KeyT, ValueT>()
+        , ProbeDistance(0)
+    { }
+
+    template<typename... Args>
+    ProbeDistanceHashBucket(const KeyT& key, Args&& ...args) noexcept
+        : HashBucket<KeyT, ValueT>(key, ::std::forward<Args>(args)...)
+        , ProbeDistance(0)
+    { }
+
+    template<typename... Args>
+    ProbeDistanceHashBucket(KeyT&& key, Args&& ...args) noexcept
+        : HashBucket<KeyT, ValueT>(::std::move(key), ::std::forward<Args>(args)...)
+        , ProbeDistance(0)
+    { }
+};
+
+/**
+ *   Sizes the table using a list of primes, the home bucket is
+ * the hash code modulo the bucket count.
+ *
+ *   This is tolerant of poor hash functions, but computing the
+ * home bucket costs an integer division, and the table can't
+ * grow past the largest prime.
+ */
+struct PrimeCapacityPolicy final
 {
-private:
     static constexpr uSys BucketSizes[] = {
               13,      17,      29, 43, 71,
              139,     353,     733,
@@ -73,17 +138,348 @@ private:
         12002869,
     };
 
-    using Bucket_t = HashBucket<KeyT, ValueT>;
+    static constexpr uSys MaxIndex = ::std::size(BucketSizes) - 1;
+
+    [[nodiscard]] static constexpr uSys FindIndex(const uSys minElementCount) noexcept
+    {
+        constexpr uSys BucketSizeCount = ::std::size(BucketSizes);
+        uSys currentIndex = BucketSizeCount >> 1;
+        uSys minBound = 0;
+        uSys maxBound = BucketSizeCount - 1;
+
+        do
+        {
+            if(minElementCount == BucketSizes[currentIndex])
+            {
+                return currentIndex;
+            }
+
+            if(minBound == maxBound)
+            {
+                if(currentIndex >= BucketSizeCount)
+                {
+                    return static_cast<uSys>(-1);
+                }
+
+                return currentIndex;
+            }
+
+            if(minElementCount > BucketSizes[currentIndex])
+            {
+                minBound = currentIndex;
+            }
+            else if(minElementCount < BucketSizes[currentIndex])
+            {
+                maxBound = currentIndex;
+            }
+
+            const uSys prevCurrentIndex = currentIndex;
+            currentIndex = ((maxBound - minBound) >> 1) + minBound;
+            if(prevCurrentIndex == currentIndex)
+            {
+                return currentIndex + 1;
+            }
+        } while(true);
+    }
+
+    [[nodiscard]] static constexpr uSys BucketCount(const uSys bucketCountIndex) noexcept
+    { return BucketSizes[bucketCountIndex]; }
+
+    [[nodiscard]] static constexpr uSys HomeIndex(const uSys hashCode, const uSys bucketCountIndex, const uSys bucketCount) noexcept
+    {
+        (void) bucketCountIndex;
+        return hashCode % bucketCount;
+    }
+
+    /**
+     *   Probing only ever steps a short distance past the end of
+     * the table, so the division is only needed when it
+     * actually wraps.
+     */
+    [[nodiscard]] static constexpr uSys Wrap(const uSys bucketIndex, const uSys bucketCountIndex, const uSys bucketCount) noexcept
+    {
+        (void) bucketCountIndex;
+        return bucketIndex < bucketCount ? bucketIndex : bucketIndex % bucketCount;
+    }
+};
+
+/**
+ *   Sizes the table using powers of 2.
+ *
+ *   The hash code is mixed using Fibonacci (multiplicative)
+ * hashing and the home bucket is taken from the high bits of
+ * the product, thus computing the home bucket is a multiply
+ * and a shift, and wrapping a probe is a mask. The mixing
+ * prevents the clustering that masking off the low bits of a
+ * poor hash code (such as the identity hash of integers) would
+ * cause.
+ *
+ *   The bucket count index is the log2 of the bucket count, the
+ * size is only limited by the address space.
+ */
+struct PowerOfTwoCapacityPolicy final
+{
+    static constexpr uSys MinIndex = 3;
+    static constexpr uSys MaxIndex = sizeof(uSys) * 8 - 2;
+
+    static constexpr uSys FibonacciMultiplier = sizeof(uSys) == 8 ? static_cast<uSys>(0x9E3779B97F4A7C15ull) : static_cast<uSys>(0x9E3779B9u);
+
+    [[nodiscard]] static constexpr uSys FindIndex(const uSys minElementCount) noexcept
+    {
+        if(minElementCount <= (uSys { 1 } << MinIndex))
+        {
+            return MinIndex;
+        }
+
+        return log2i(nextPowerOf2(minElementCount));
+    }
+
+    [[nodiscard]] static constexpr uSys BucketCount(const uSys bucketCountIndex) noexcept
+    { return uSys { 1 } << bucketCountIndex; }
+
+    [[nodiscard]] static constexpr uSys HomeIndex(const uSys hashCode, const uSys bucketCountIndex, const uSys bucketCount) noexcept
+    {
+        (void) bucketCount;
+        return (hashCode * FibonacciMultiplier) >> (sizeof(uSys) * 8 - bucketCountIndex);
+    }
+
+    [[nodiscard]] static constexpr uSys Wrap(const uSys bucketIndex, const uSys bucketCountIndex, const uSys bucketCount) noexcept
+    {
+        (void) bucketCountIndex;
+        return bucketIndex & (bucketCount - 1);
+    }
+};
+
+template<typename KeyT, typename ValueT, typename CapacityPolicyT, uSys ShardCount>
+class ConcurrentHashTable;
+
+enum class HashProbeMethod
+{
+    Quadratic,
+    Linear,
+    RobinHood
+};
+
+/**
+ *   Probes with triangular increments from the home bucket,
+ * which spreads out clusters of colliding hash codes.
+ *
+ *   Removal leaves a tombstone behind so that probe sequences
+ * passing through it remain intact.
+ */
+struct QuadraticProbePolicy final
+{
+    template<typename KeyT, typename ValueT>
+    using Bucket = HashBucket<KeyT, ValueT>;
+
+    static constexpr HashProbeMethod Method = HashProbeMethod::Quadratic;
+
+    [[nodiscard]] static constexpr uSys MaxLoad(const uSys bucketCount) noexcept
+    { return (bucketCount >> 1) + (bucketCount >> 2); }
+};
+
+/**
+ *   Probes the buckets following the home bucket in order. This
+ * is the most cache friendly sequence, but is sensitive to
+ * clustering, so the load factor is kept at 75%.
+ *
+ *   Removal shifts later entries of the cluster back into the
+ * hole instead of leaving a tombstone.
+ */
+struct LinearProbePolicy final
+{
+    template<typename KeyT, typename ValueT>
+    using Bucket = ProbeDistanceHashBucket<KeyT, ValueT>;
+
+    static constexpr HashProbeMethod Method = HashProbeMethod::Linear;
+
+    [[nodiscard]] static constexpr uSys MaxLoad(const uSys bucketCount) noexcept
+    { return (bucketCount >> 1) + (bucketCount >> 2); }
+};
+
+/**
+ *   Linear probing with Robin Hood displacement. An entry being
+ * inserted takes the bucket of any entry that is closer to its
+ * own home bucket, keeping every cluster ordered by home bucket.
+ * This bounds the variance of probe lengths, lets lookups for
+ * missing keys stop as soon as they pass where the key would
+ * have been, and allows the table to run at a 90% load factor.
+ *
+ *   Removal shifts the rest of the cluster back by one bucket.
+ */
+struct RobinHoodProbePolicy final
+{
+    template<typename KeyT, typename ValueT>
+    using Bucket = ProbeDistanceHashBucket<KeyT, ValueT>;
+
+    static constexpr HashProbeMethod Method = HashProbeMethod::RobinHood;
+
+    [[nodiscard]] static constexpr uSys MaxLoad(const uSys bucketCount) noexcept
+    { return bucketCount - bucketCount / 10 - 1; }
+};
+
+/**
+ *   Moves every entry into the new bucket array as soon as the
+ * load threshold is crossed.
+ */
+struct ImmediateRehashPolicy final
+{
+    static constexpr bool IsIncremental = false;
+    static constexpr uSys BucketsPerStep = 0;
+};
+
+/**
+ *   Spreads the cost of a rehash across later operations. When
+ * the load threshold is crossed the new bucket array is
+ * allocated, but the old one is kept alongside it. Every insert,
+ * remove, and non-const lookup then moves `BucketsPerStepT`
+ * buckets out of the old array, and lookups check both arrays
+ * until the old one is empty.
+ *
+ *   This bounds the work done by any single operation, at the
+ * cost of the old array living a little longer and lookups of
+ * missing keys probing twice while a rehash is in progress.
+ */
+template<uSys BucketsPerStepT = 32>
+struct IncrementalRehashPolicy final
+{
+    static_assert(BucketsPerStepT > 0, "BucketsPerStepT must be at least 1.");
+
+    static constexpr bool IsIncremental = true;
+    static constexpr uSys BucketsPerStep = BucketsPerStepT;
+};
+
+/**
+ *   Allows a HashTable keyed by KeyT to be searched using a
+ * LookupT, without having to construct a KeyT. Specializations
+ * set IsTransparent and provide a Hash function which must
+ * produce the same hash code as `std::hash<KeyT>` does for an
+ * equal key, and an Equals function comparing the two.
+ *
+ *   LookupT is decayed, so string literals are looked up as
+ * character pointers.
+ */
+template<typename KeyT, typename LookupT>
+struct HashTableLookup final
+{
+    static constexpr bool IsTransparent = false;
+};
+
+template<typename Char>
+struct HashTableLookup<DynStringT<Char>, DynStringViewT<Char>> final
+{
+    static constexpr bool IsTransparent = true;
+
+    [[nodiscard]] static uSys Hash(const DynStringViewT<Char>& key) noexcept
+    { return key.HashCode(); }
+
+    [[nodiscard]] static bool Equals(const DynStringT<Char>& lhs, const DynStringViewT<Char>& rhs) noexcept
+    { return lhs.Equals(rhs); }
+};
+
+template<typename Char>
+struct HashTableLookup<DynStringT<Char>, ConstExprStringT<Char>> final
+{
+    static constexpr bool IsTransparent = true;
+
+    [[nodiscard]] static uSys Hash(const ConstExprStringT<Char>& key) noexcept
+    { return key.HashCode(); }
+
+    [[nodiscard]] static bool Equals(const DynStringT<Char>& lhs, const ConstExprStringT<Char>& rhs) noexcept
+    { return lhs.Equals(rhs); }
+};
+
+template<typename Char>
+struct HashTableLookup<DynStringT<Char>, const Char*> final
+{
+    static constexpr bool IsTransparent = true;
+
+    [[nodiscard]] static uSys Hash(const Char* const key) noexcept
+    { return findHashCode(key); }
+
+    [[nodiscard]] static bool Equals(const DynStringT<Char>& lhs, const Char* const rhs) noexcept
+    { return lhs.Equals(rhs); }
+};
+
+template<typename Char>
+struct HashTableLookup<DynStringT<Char>, Char*> final
+{
+    static constexpr bool IsTransparent = true;
+
+    [[nodiscard]] static uSys Hash(const Char* const key) noexcept
+    { return findHashCode(key); }
+
+    [[nodiscard]] static bool Equals(const DynStringT<Char>& lhs, const Char* const rhs) noexcept
+    { return lhs.Equals(rhs); }
+};
+
+/**
+ *   An open addressing hash table.
+ *
+ *   How collisions are resolved is controlled by `ProbePolicyT`,
+ * one of `QuadraticProbePolicy`, `LinearProbePolicy`, or
+ * `RobinHoodProbePolicy`. How the bucket count grows and how a
+ * hash code maps to a home bucket is controlled by
+ * `CapacityPolicyT`, either `PrimeCapacityPolicy` or
+ * `PowerOfTwoCapacityPolicy`.
+ *
+ *   With quadratic probing removed entries leave a tombstone
+ * behind. Insertion reuses tombstones, and tombstones count
+ * towards the load factor. Once the load threshold is hit the
+ * table is rehashed, this is done in place (discarding the
+ * tombstones) when fewer than half the buckets are live, and
+ * otherwise grows the table. This keeps probe lengths bounded
+ * regardless of how much insert/remove churn the table sees.
+ * The linear policies never leave tombstones.
+ *
+ *   `RehashPolicyT` controls whether a rehash happens all at
+ * once, `ImmediateRehashPolicy`, or is spread over subsequent
+ * operations, `IncrementalRehashPolicy`.
+ *
+ *   `TrackingT` enables recording probe lengths and rehash costs,
+ * which can be retrieved with `Statistics`. It defaults to
+ * `HashTableTracking::None`, which records nothing and adds no
+ * overhead.
+ */
+template<typename KeyT, typename ValueT, typename CapacityPolicyT = PrimeCapacityPolicy, typename ProbePolicyT = QuadraticProbePolicy, typename RehashPolicyT = ImmediateRehashPolicy, HashTableTracking TrackingT = HashTableTracking::None>
+class HashTable final : private HashTableStatsRecorder<TrackingT>
+{
+    DELETE_CM(HashTable);
+private:
+    using Bucket_t = typename ProbePolicyT::template Bucket<KeyT, ValueT>;
     using BucketArr_t = Bucket_t*;
     // using BucketArr_t = Bucket_t**;
     static constexpr bool IsBucketPointer = ::std::is_pointer_v<::std::remove_pointer_t<BucketArr_t>>;
+
+    static constexpr uSys InvalidIndex = static_cast<uSys>(-1);
+    static constexpr uSys BatchSize = 16;
+    static constexpr bool IsLinear = ProbePolicyT::Method != HashProbeMethod::Quadratic;
+    static constexpr bool IsRobinHood = ProbePolicyT::Method == HashProbeMethod::RobinHood;
+    static constexpr bool IsIncremental = RehashPolicyT::IsIncremental;
+    static constexpr bool IsTracking = TrackingT != HashTableTracking::None;
+
+    template<typename LookupT>
+    static constexpr bool IsLookup = HashTableLookup<KeyT, ::std::decay_t<LookupT>>::IsTransparent && !::std::is_same_v<::std::decay_t<LookupT>, KeyT>;
+
+    template<typename, typename, typename, uSys>
+    friend class ConcurrentHashTable;
 private:
     TauAllocator* m_ArrayAllocator;
     TauAllocator* m_NodeAllocator;
     uSys m_BucketCountIndex;
     uSys m_BucketCount;
     uSys m_ActiveElementCount;
+    uSys m_DeletedElementCount;
     BucketArr_t m_Buckets;
+    /**
+     *   The bucket array being migrated from by an incremental
+     * rehash, this is null when no rehash is in progress.
+     * Buckets before m_MigrateIndex have already been moved.
+     */
+    BucketArr_t m_OldBuckets;
+    uSys m_OldBucketCountIndex;
+    uSys m_OldBucketCount;
+    uSys m_MigrateIndex;
 public:
     HashTable(
         const uSys minCount = 1,
@@ -92,24 +488,67 @@ public:
     ) noexcept
         : m_ArrayAllocator(&arrayAllocator)
         , m_NodeAllocator(&nodeAllocator)
-        , m_BucketCountIndex(FindNextBucketCount(minCount))
-        , m_BucketCount(BucketSizes[m_BucketCountIndex])
+        , m_BucketCountIndex(CapacityPolicyT::FindIndex(minCount))
+        , m_BucketCount(CapacityPolicyT::BucketCount(m_BucketCountIndex))
         , m_ActiveElementCount(0)
-        , m_Buckets(reinterpret_cast<decltype(m_Buckets)>(arrayAllocator.Allocate(sizeof(*m_Buckets) * m_BucketCount)))
+        , m_DeletedElementCount(0)
+        , m_Buckets(AllocateBuckets(arrayAllocator, m_BucketCount))
+        , m_OldBuckets(nullptr)
+        , m_OldBucketCountIndex(0)
+        , m_OldBucketCount(0)
+        , m_MigrateIndex(0)
+    { }
+
+    ~HashTable() noexcept
     {
-        if constexpr(IsBucketPointer)
+        for(uSys i = 0; i < m_BucketCount; ++i)
         {
-            (void) ::std::fill_n(m_Buckets, m_BucketCount, nullptr);
+            if(IsFull(m_Buckets[i]))
+            {
+                DestroyBucket(m_Buckets[i]);
+            }
         }
-        else
+
+        m_ArrayAllocator->Deallocate(m_Buckets);
+
+        if(m_OldBuckets)
         {
-            (void) ::std::fill_n(m_Buckets, m_BucketCount, Bucket_t());
+            for(uSys i = m_MigrateIndex; i < m_OldBucketCount; ++i)
+            {
+                if(IsFull(m_OldBuckets[i]))
+                {
+                    DestroyBucket(m_OldBuckets[i]);
+                }
+            }
+
+            m_ArrayAllocator->Deallocate(m_OldBuckets);
         }
     }
 
+    [[nodiscard]] uSys Count() const noexcept { return m_ActiveElementCount; }
+    [[nodiscard]] uSys BucketCount() const noexcept { return m_BucketCount; }
+    [[nodiscard]] bool IsRehashing() const noexcept { return m_OldBuckets; }
+
+    template<HashTableTracking TrackingU = TrackingT, ::std::enable_if_t<TrackingU != HashTableTracking::None, int> = 0>
+    [[nodiscard]] HashTableStats Statistics() const noexcept
+    {
+        HashTableStats stats = this->m_Stats;
+        stats.Count = m_ActiveElementCount;
+        stats.BucketCount = m_BucketCount;
+        stats.DeletedCount = m_DeletedElementCount;
+        return stats;
+    }
+
+    template<HashTableTracking TrackingU = TrackingT, ::std::enable_if_t<TrackingU != HashTableTracking::None, int> = 0>
+    void ResetStatistics() noexcept
+    {
+        this->m_Stats = { };
+    }
+
     void Insert(const KeyT& key, const ValueT& value) noexcept
     {
-        const uSys hashIndex = PreInsert(key);
+        uSys probeDistance;
+        const uSys hashIndex = PreInsert(key, probeDistance);
 
         if constexpr(IsBucketPointer)
         {
@@ -119,11 +558,14 @@ public:
         {
             ::std::construct_at(&m_Buckets[hashIndex], key, value);
         }
+
+        SetProbeDistance(m_Buckets[hashIndex], probeDistance);
     }
 
     void Insert(const KeyT& key, ValueT&& value) noexcept
     {
-        const uSys hashIndex = PreInsert(key);
+        uSys probeDistance;
+        const uSys hashIndex = PreInsert(key, probeDistance);
 
         if constexpr(IsBucketPointer)
         {
@@ -133,172 +575,590 @@ public:
         {
             ::std::construct_at(&m_Buckets[hashIndex], key, ::std::move(value));
         }
+
+        SetProbeDistance(m_Buckets[hashIndex], probeDistance);
     }
 
     [[nodiscard]] bool Contains(const KeyT& key) const noexcept
     {
-        const uSys hashCode = ::std::hash<KeyT>::operator()(key);
+        return FindBucket(key, KeyHash(key));
+    }
+
+    template<typename LookupT, ::std::enable_if_t<IsLookup<LookupT>, int> = 0>
+    [[nodiscard]] bool Contains(const LookupT& key) const noexcept
+    {
+        return FindBucket(key, LookupHash(key));
+    }
+
+    [[nodiscard]] ValueT* Get(const KeyT& key) noexcept
+    {
+        return GetWithAdjustedHash(KeyHash(key), key);
+    }
+
+    /**
+     *   Unlike the non-const overload this never advances an
+     * incremental rehash.
+     */
+    [[nodiscard]] const ValueT* Get(const KeyT& key) const noexcept
+    {
+        const Bucket_t* const bucket = FindBucket(key, KeyHash(key));
+        return bucket ? bucket->ValuePtr() : nullptr;
+    }
+
+    /**
+     *   Finds the entry for a key of a different type, such as a
+     * `DynStringView` or `const char*` for `DynString` keys,
+     * without constructing a `KeyT`. The pair of types has to be
+     * enabled with `HashTableLookup`.
+     */
+    template<typename LookupT, ::std::enable_if_t<IsLookup<LookupT>, int> = 0>
+    [[nodiscard]] ValueT* Get(const LookupT& key) noexcept
+    {
+        return GetWithAdjustedHash(LookupHash(key), key);
+    }
+
+    template<typename LookupT, ::std::enable_if_t<IsLookup<LookupT>, int> = 0>
+    [[nodiscard]] const ValueT* Get(const LookupT& key) const noexcept
+    {
+        const Bucket_t* const bucket = FindBucket(key, LookupHash(key));
+        return bucket ? bucket->ValuePtr() : nullptr;
+    }
+
+    /**
+     *   Looks up every key in keys, storing a pointer to its value,
+     * or null if it isn't present, at the same index in values.
+     *
+     *   Keys are processed in small batches, all keys in a batch are
+     * hashed and their home buckets prefetched before any of them
+     * are probed. This lets the cache misses of large tables
+     * overlap instead of stalling on each key in turn.
+     */
+    void GetBatch(const ::std::span<const KeyT> keys, const ::std::span<ValueT*> values) noexcept
+    {
+        MigrateStep();
+        ResolveBatch(keys, values);
+    }
+
+    void GetBatch(const ::std::span<const KeyT> keys, const ::std::span<const ValueT*> values) const noexcept
+    {
+        ResolveBatch(keys, values);
+    }
+
+    /**
+     *   Finds the entry for key using a hash code the caller already
+     * has, such as `StringBaseT::HashCode()`, skipping the call to
+     * `std::hash`. The hash code must be the one `std::hash<KeyT>`
+     * produces for the key, and key may be a `KeyT` or any type
+     * enabled with `HashTableLookup`.
+     */
+    template<typename LookupT>
+    [[nodiscard]] ValueT* GetWithHash(const uSys hashCode, const LookupT& key) noexcept
+    {
+        return GetWithAdjustedHash(Bucket_t::AdjustHashCode(hashCode), key);
+    }
 
-        uSys hashIndex = hashCode % m_BucketCount;
+    template<typename LookupT>
+    [[nodiscard]] const ValueT* GetWithHash(const uSys hashCode, const LookupT& key) const noexcept
+    {
+        const Bucket_t* const bucket = FindBucket(key, Bucket_t::AdjustHashCode(hashCode));
+        return bucket ? bucket->ValuePtr() : nullptr;
+    }
+
+    /**
+     *   Removes the entry for key, destroying both the key and the
+     * value.
+     *
+     * @return
+     *      Whether the key was present.
+     */
+    bool Remove(const KeyT& key) noexcept
+    {
+        return RemoveWithAdjustedHash(KeyHash(key), key);
+    }
+
+    template<typename LookupT, ::std::enable_if_t<IsLookup<LookupT>, int> = 0>
+    bool Remove(const LookupT& key) noexcept
+    {
+        return RemoveWithAdjustedHash(LookupHash(key), key);
+    }
+private:
+    [[nodiscard]] static uSys KeyHash(const KeyT& key) noexcept
+    {
+        return Bucket_t::AdjustHashCode(::std::hash<KeyT> {}(key));
+    }
+
+    template<typename LookupT>
+    [[nodiscard]] static uSys LookupHash(const LookupT& key) noexcept
+    {
+        return Bucket_t::AdjustHashCode(HashTableLookup<KeyT, ::std::decay_t<LookupT>>::Hash(key));
+    }
 
-        for(uSys quadraticIndex = 1; true; ++quadraticIndex)
+    template<typename LookupT>
+    [[nodiscard]] static bool KeysEqual(const KeyT& key, const LookupT& lookup) noexcept
+    {
+        if constexpr(IsLookup<LookupT>)
+        {
+            return HashTableLookup<KeyT, ::std::decay_t<LookupT>>::Equals(key, lookup);
+        }
+        else
         {
-            if(IsTombstone(m_Buckets[hashIndex]))
+            return key == lookup;
+        }
+    }
+
+    template<typename ValuePtrT>
+    void ResolveBatch(const ::std::span<const KeyT> keys, const ::std::span<ValuePtrT> values) const noexcept
+    {
+        assert(keys.size() == values.size());
+
+        uSys hashCodes[BatchSize];
+        uSys homeIndices[BatchSize];
+
+        for(uSys begin = 0; begin < keys.size(); begin += BatchSize)
+        {
+            const uSys count = ::std::min(BatchSize, keys.size() - begin);
+
+            for(uSys i = 0; i < count; ++i)
+            {
+                hashCodes[i] = KeyHash(keys[begin + i]);
+                homeIndices[i] = CapacityPolicyT::HomeIndex(hashCodes[i], m_BucketCountIndex, m_BucketCount);
+                PREFETCH(&m_Buckets[homeIndices[i]]);
+            }
+
+            for(uSys i = 0; i < count; ++i)
             {
-                return false;
+                const Bucket_t* const bucket = FindBucket(keys[begin + i], hashCodes[i], homeIndices[i]);
+                values[begin + i] = bucket ? const_cast<ValuePtrT>(bucket->ValuePtr()) : nullptr;
             }
+        }
+    }
+
+    template<typename LookupT>
+    [[nodiscard]] ValueT* GetWithAdjustedHash(const uSys hashCode, const LookupT& key) noexcept
+    {
+        MigrateStep();
+
+        const Bucket_t* const bucket = FindBucket(key, hashCode);
+        return bucket ? const_cast<ValueT*>(bucket->ValuePtr()) : nullptr;
+    }
+
+    template<typename LookupT>
+    bool RemoveWithAdjustedHash(const uSys hashCode, const LookupT& key) noexcept
+    {
+        MigrateStep();
+
+        const uSys hashIndex = FindIndex(key, hashCode, m_Buckets, m_BucketCountIndex, m_BucketCount);
 
-            if(DeReference(m_Buckets[hashIndex]).HashCode == hashCode)
+        if(hashIndex == InvalidIndex)
+        {
+            if constexpr(IsIncremental)
             {
-                if((*const_cast<const KeyT*>(DeReference(m_Buckets[hashIndex]).KeyPtr())) == key)
+                if(m_OldBuckets)
                 {
-                    return true;
+                    return RemoveOld(hashCode, key);
                 }
             }
 
-            hashIndex = (hashCode + quadraticIndex * quadraticIndex) % m_BucketCount;
+            return false;
+        }
+
+        DestroyBucket(m_Buckets[hashIndex]);
+        --m_ActiveElementCount;
+
+        if constexpr(IsLinear)
+        {
+            ShiftBackward(hashIndex);
         }
+        else
+        {
+            MarkDeleted(m_Buckets[hashIndex]);
+            ++m_DeletedElementCount;
+        }
+
+        return true;
     }
 
-    [[nodiscard]] ValueT* Get(const KeyT& key) noexcept
+    template<typename LookupT>
+    [[nodiscard]] const Bucket_t* FindBucket(const LookupT& key, const uSys hashCode) const noexcept
     {
-        const uSys hashCode = ::std::hash<KeyT> {}(key);
+        return FindBucket(key, hashCode, CapacityPolicyT::HomeIndex(hashCode, m_BucketCountIndex, m_BucketCount));
+    }
 
-        uSys hashIndex = hashCode % m_BucketCount;
+    /**
+     *   Finds the bucket for key, where homeIndex is the home bucket
+     * of hashCode in the current bucket array.
+     */
+    template<typename LookupT>
+    [[nodiscard]] const Bucket_t* FindBucket(const LookupT& key, const uSys hashCode, const uSys homeIndex) const noexcept
+    {
+        uSys probeLength;
+        const uSys hashIndex = FindIndexFrom(key, hashCode, homeIndex, m_Buckets, m_BucketCountIndex, m_BucketCount, probeLength);
 
-        for(uSys quadraticIndex = 1; true; ++quadraticIndex)
+        if(hashIndex != InvalidIndex)
         {
-            if(IsTombstone(m_Buckets[hashIndex]))
+            this->RecordLookupProbe(probeLength);
+            return &DeReference(m_Buckets[hashIndex]);
+        }
+
+        if constexpr(IsIncremental)
+        {
+            if(m_OldBuckets)
             {
-                return nullptr;
+                uSys oldProbeLength;
+                const uSys oldIndex = FindIndexFrom(key, hashCode, CapacityPolicyT::HomeIndex(hashCode, m_OldBucketCountIndex, m_OldBucketCount), m_OldBuckets, m_OldBucketCountIndex, m_OldBucketCount, oldProbeLength);
+                probeLength += oldProbeLength;
+
+                if(oldIndex != InvalidIndex)
+                {
+                    this->RecordLookupProbe(probeLength);
+                    return &DeReference(m_OldBuckets[oldIndex]);
+                }
+            }
+        }
+
+        this->RecordLookupProbe(probeLength);
+        return nullptr;
+    }
+
+    template<typename LookupT>
+    [[nodiscard]] static uSys FindIndex(const LookupT& key, const uSys hashCode, const BucketArr_t buckets, const uSys bucketCountIndex, const uSys bucketCount) noexcept
+    {
+        uSys probeLength;
+        return FindIndexFrom(key, hashCode, CapacityPolicyT::HomeIndex(hashCode, bucketCountIndex, bucketCount), buckets, bucketCountIndex, bucketCount, probeLength);
+    }
+
+    /**
+     *   Searches the probe sequence starting at hashIndex, storing
+     * the number of buckets inspected beyond the first in
+     * probeLength.
+     */
+    template<typename LookupT>
+    [[nodiscard]] static uSys FindIndexFrom(const LookupT& key, const uSys hashCode, uSys hashIndex, const BucketArr_t buckets, const uSys bucketCountIndex, const uSys bucketCount, uSys& probeLength) noexcept
+    {
+        for(uSys probeIndex = 1; probeIndex <= bucketCount; ++probeIndex)
+        {
+            probeLength = probeIndex - 1;
+
+            if(IsEmpty(buckets[hashIndex]))
+            {
+                return InvalidIndex;
             }
 
-            if(DeReference(m_Buckets[hashIndex]).HashCode == hashCode)
+            // Deleted buckets never match as their hash code is a sentinel.
+            const Bucket_t& bucket = DeReference(buckets[hashIndex]);
+
+            if constexpr(IsRobinHood)
             {
-                if((*const_cast<const KeyT*>(DeReference(m_Buckets[hashIndex]).KeyPtr())) == key)
+                // Clusters are ordered by home bucket, we've passed where the key would be.
+                if(bucket.ProbeDistance < probeIndex - 1)
                 {
-                    return DeReference(m_Buckets[hashIndex]).ValuePtr();
+                    return InvalidIndex;
                 }
             }
 
-            hashIndex = (hashCode + quadraticIndex * quadraticIndex) % m_BucketCount;
+            if(bucket.HashCode == hashCode)
+            {
+                if(KeysEqual(*bucket.KeyPtr(), key))
+                {
+                    return hashIndex;
+                }
+            }
+
+            hashIndex = NextIndex(hashIndex, probeIndex, bucketCountIndex, bucketCount);
         }
-    }
 
-    [[nodiscard]] const ValueT* Get(const KeyT& key) const noexcept
-    {
-        return const_cast<HashTable<KeyT, ValueT>*>(this)->Get(key);
+        return InvalidIndex;
     }
-private:
-    [[nodiscard]] uSys PreInsert(const KeyT& key) noexcept
+
+    [[nodiscard]] uSys PreInsert(const KeyT& key, uSys& probeDistance) noexcept
     {
+        MigrateStep();
+
         ++m_ActiveElementCount;
 
-        if(m_ActiveElementCount >= (m_BucketCount >> 1) + (m_BucketCount >> 2))
+        if(m_ActiveElementCount + m_DeletedElementCount >= ProbePolicyT::MaxLoad(m_BucketCount))
         {
-            Expand();
+            if(m_ActiveElementCount < (m_BucketCount >> 1))
+            {
+                // Mostly tombstones, reclaim them without growing.
+                Rehash(m_BucketCountIndex);
+            }
+            else
+            {
+                Rehash(m_BucketCountIndex + 1);
+            }
         }
 
-        return KeyFunc(key, m_Buckets, m_BucketCount);
+        const uSys hashCode = KeyHash(key);
+        const uSys hashIndex = KeyFunc(hashCode, m_Buckets, m_BucketCountIndex, m_BucketCount, probeDistance);
+        this->RecordInsertProbe(probeDistance);
+
+        if(IsDeleted(m_Buckets[hashIndex]))
+        {
+            --m_DeletedElementCount;
+        }
+
+        return hashIndex;
+    }
 
+    [[nodiscard]] static uSys NextIndex(const uSys hashIndex, const uSys probeIndex, const uSys bucketCountIndex, const uSys bucketCount) noexcept
+    {
+        if constexpr(IsLinear)
+        {
+            (void) probeIndex;
+            return CapacityPolicyT::Wrap(hashIndex + 1, bucketCountIndex, bucketCount);
+        }
+        else
+        {
+            return CapacityPolicyT::Wrap(hashIndex + probeIndex, bucketCountIndex, bucketCount);
+        }
     }
 
-    [[nodiscard]] static uSys KeyFunc(const uSys hashCode, const decltype(m_Buckets) buckets, const uSys bucketCount) noexcept
+    /**
+     *   Finds the bucket a new entry should be placed in, along with
+     * how far that bucket is from the entry's home bucket.
+     *
+     *   For quadratic and linear probing this is the first empty or
+     * deleted bucket in the probe sequence. For Robin Hood probing
+     * it is the first bucket that is either empty or holds an entry
+     * closer to its home bucket, that entry and the rest of its
+     * cluster are moved forward by one bucket to make room.
+     */
+    [[nodiscard]] static uSys KeyFunc(const uSys hashCode, const decltype(m_Buckets) buckets, const uSys bucketCountIndex, const uSys bucketCount, uSys& probeDistance) noexcept
     {
-        uSys hashIndex = hashCode % bucketCount;
+        uSys hashIndex = CapacityPolicyT::HomeIndex(hashCode, bucketCountIndex, bucketCount);
 
-        for(uSys quadraticIndex = 1; !IsTombstone(buckets[hashIndex]); ++quadraticIndex)
+        for(probeDistance = 0; IsFull(buckets[hashIndex]); ++probeDistance)
         {
-            hashIndex = (hashCode + quadraticIndex * quadraticIndex) % bucketCount;
+            if constexpr(IsRobinHood)
+            {
+                if(DeReference(buckets[hashIndex]).ProbeDistance < probeDistance)
+                {
+                    ShiftForward(buckets, hashIndex, bucketCountIndex, bucketCount);
+                    break;
+                }
+            }
+
+            hashIndex = NextIndex(hashIndex, probeDistance + 1, bucketCountIndex, bucketCount);
         }
 
         return hashIndex;
     }
 
-    [[nodiscard]] static uSys KeyFunc(const KeyT& key, const BucketArr_t buckets, const uSys bucketCount) noexcept
+    /**
+     *   Moves the cluster starting at hashIndex forward by one
+     * bucket, up to the next empty bucket. The bucket at hashIndex
+     * is left holding a stale copy which is expected to be
+     * overwritten.
+     */
+    static void ShiftForward(const BucketArr_t buckets, const uSys hashIndex, const uSys bucketCountIndex, const uSys bucketCount) noexcept
     {
-        return KeyFunc(::std::hash<KeyT>{}(key), buckets, bucketCount);
+        uSys emptyIndex = hashIndex;
+
+        do
+        {
+            emptyIndex = NextIndex(emptyIndex, 1, bucketCountIndex, bucketCount);
+        } while(!IsEmpty(buckets[emptyIndex]));
+
+        while(emptyIndex != hashIndex)
+        {
+            const uSys prevIndex = emptyIndex == 0 ? bucketCount - 1 : emptyIndex - 1;
+            buckets[emptyIndex] = buckets[prevIndex];
+            ++DeReference(buckets[emptyIndex]).ProbeDistance;
+            emptyIndex = prevIndex;
+        }
     }
 
-    void Expand() noexcept
+    /**
+     *   Fills the hole left at hashIndex by a removed entry with
+     * later entries from the same cluster, then marks the final
+     * hole empty.
+     *
+     *   With Robin Hood ordering every following entry that isn't in
+     * its home bucket simply moves back by one. With plain linear
+     * probing an entry may only move into the hole if the hole is
+     * not before its home bucket.
+     */
+    void ShiftBackward(uSys hashIndex) noexcept
     {
-        ++m_BucketCountIndex;
+        uSys nextIndex = NextIndex(hashIndex, 1, m_BucketCountIndex, m_BucketCount);
 
-        if(m_BucketCountIndex >= ::std::size(BucketSizes))
+        for(uSys gap = 1; !IsEmpty(m_Buckets[nextIndex]); ++gap)
         {
-            ::std::exit(static_cast<int>(Bucket_t::TombstoneValue));
-        }
+            const uSys probeDistance = DeReference(m_Buckets[nextIndex]).ProbeDistance;
+
+            if constexpr(IsRobinHood)
+            {
+                if(probeDistance == 0)
+                {
+                    break;
+                }
+            }
+
+            if(probeDistance >= gap)
+            {
+                m_Buckets[hashIndex] = m_Buckets[nextIndex];
+                DeReference(m_Buckets[hashIndex]).ProbeDistance -= gap;
+                hashIndex = nextIndex;
+                gap = 0;
+            }
 
-        const uSys newBucketCount = BucketSizes[m_BucketCountIndex];
+            nextIndex = NextIndex(nextIndex, 1, m_BucketCountIndex, m_BucketCount);
+        }
 
-        auto newBuckets = reinterpret_cast<BucketArr_t>(m_ArrayAllocator->Allocate(sizeof(*m_Buckets) * newBucketCount));
+        MarkEmpty(m_Buckets[hashIndex]);
+    }
 
-        if constexpr(IsBucketPointer)
+    void Rehash(const uSys newBucketCountIndex) noexcept
+    {
+        if(newBucketCountIndex > CapacityPolicyT::MaxIndex)
         {
-            (void) ::std::fill_n(newBuckets, newBucketCount, nullptr);
+            ::std::exit(static_cast<int>(Bucket_t::EmptyValue));
         }
-        else
+
+        const u64 rehashBegin = this->RehashBegin();
+        const uSys newBucketCount = CapacityPolicyT::BucketCount(newBucketCountIndex);
+
+        auto newBuckets = AllocateBuckets(*m_ArrayAllocator, newBucketCount);
+
+        if constexpr(IsIncremental)
         {
-            (void) ::std::fill_n(newBuckets, newBucketCount, Bucket_t());
-        }
+            // The new array can fill up before the last rehash finished.
+            if(m_OldBuckets)
+            {
+                MigrateBuckets(m_OldBucketCount);
+            }
 
-        for(uSys i = 0; i < m_BucketCount; ++i)
+            m_OldBuckets = m_Buckets;
+            m_OldBucketCountIndex = m_BucketCountIndex;
+            m_OldBucketCount = m_BucketCount;
+            m_MigrateIndex = 0;
+        }
+        else
         {
-            if(!IsTombstone(m_Buckets[i]))
+            for(uSys i = 0; i < m_BucketCount; ++i)
             {
-                const uSys hashIndex = KeyFunc(DeReference(m_Buckets[i]).HashCode, newBuckets, newBucketCount);
-                newBuckets[hashIndex] = m_Buckets[i];
+                if(IsFull(m_Buckets[i]))
+                {
+                    uSys probeDistance;
+                    const uSys hashIndex = KeyFunc(DeReference(m_Buckets[i]).HashCode, newBuckets, newBucketCountIndex, newBucketCount, probeDistance);
+                    newBuckets[hashIndex] = m_Buckets[i];
+                    SetProbeDistance(newBuckets[hashIndex], probeDistance);
+                }
             }
+
+            m_ArrayAllocator->Deallocate(m_Buckets);
         }
 
+        m_BucketCountIndex = newBucketCountIndex;
         m_BucketCount = newBucketCount;
-        m_ArrayAllocator->Deallocate(m_Buckets);
+        m_DeletedElementCount = 0;
         m_Buckets = newBuckets;
+
+        this->RehashEnd(rehashBegin);
     }
-private:
-    [[nodiscard]] static constexpr uSys FindNextBucketCount(const uSys minElementCount) noexcept
-    {
-        constexpr uSys BucketSizeCount = ::std::size(BucketSizes);
-        uSys currentIndex = BucketSizeCount >> 1;
-        uSys minBound = 0;
-        uSys maxBound = BucketSizeCount - 1;
 
-        do
+    void MigrateStep() noexcept
+    {
+        if constexpr(IsIncremental)
         {
-            if(minElementCount == BucketSizes[currentIndex])
+            if(m_OldBuckets)
             {
-                return currentIndex;
+                const u64 migrateBegin = this->RehashBegin();
+                MigrateBuckets(RehashPolicyT::BucketsPerStep);
+                this->MigrateEnd(migrateBegin);
             }
+        }
+    }
 
-            if(minBound == maxBound)
+    /**
+     *   Moves up to bucketCount buckets from the old bucket array
+     * into the current one, releasing the old array once it has
+     * been fully migrated.
+     *
+     *   Migrated buckets are marked deleted rather than empty so
+     * that probe sequences through the old array remain intact.
+     */
+    void MigrateBuckets(const uSys bucketCount) noexcept
+    {
+        const uSys endIndex = ::std::min(m_MigrateIndex + bucketCount, m_OldBucketCount);
+
+        for(; m_MigrateIndex < endIndex; ++m_MigrateIndex)
+        {
+            ::std::remove_pointer_t<BucketArr_t>& bucket = m_OldBuckets[m_MigrateIndex];
+
+            if(IsFull(bucket))
             {
-                if(currentIndex >= BucketSizeCount)
+                uSys probeDistance;
+                const uSys hashIndex = KeyFunc(DeReference(bucket).HashCode, m_Buckets, m_BucketCountIndex, m_BucketCount, probeDistance);
+
+                if(IsDeleted(m_Buckets[hashIndex]))
                 {
-                    return static_cast<uSys>(-1);
+                    --m_DeletedElementCount;
                 }
 
-                return currentIndex;
+                m_Buckets[hashIndex] = bucket;
+                SetProbeDistance(m_Buckets[hashIndex], probeDistance);
+                MarkDeleted(bucket);
             }
+        }
 
-            if(minElementCount > BucketSizes[currentIndex])
-            {
-                minBound = currentIndex;
-            }
-            else if(minElementCount < BucketSizes[currentIndex])
-            {
-                maxBound = currentIndex;
-            }
+        if(m_MigrateIndex == m_OldBucketCount)
+        {
+            m_ArrayAllocator->Deallocate(m_OldBuckets);
+            m_OldBuckets = nullptr;
+        }
+    }
 
-            const uSys prevCurrentIndex = currentIndex;
-            currentIndex = ((maxBound - minBound) >> 1) + minBound;
-            if(prevCurrentIndex == currentIndex)
-            {
-                return currentIndex + 1;
-            }
-        } while(true);
+    /**
+     *   Removes an entry that hasn't been migrated yet. This always
+     * leaves a tombstone, shifting entries back could move them
+     * into the part of the old array that has already been
+     * migrated.
+     */
+    template<typename LookupT>
+    bool RemoveOld(const uSys hashCode, const LookupT& key) noexcept
+    {
+        const uSys hashIndex = FindIndex(key, hashCode, m_OldBuckets, m_OldBucketCountIndex, m_OldBucketCount);
+
+        if(hashIndex == InvalidIndex)
+        {
+            return false;
+        }
+
+        DestroyBucket(m_OldBuckets[hashIndex]);
+        MarkDeleted(m_OldBuckets[hashIndex]);
+        --m_ActiveElementCount;
+
+        return true;
+    }
+
+    [[nodiscard]] static BucketArr_t AllocateBuckets(TauAllocator& allocator, const uSys bucketCount) noexcept
+    {
+        const BucketArr_t buckets = reinterpret_cast<BucketArr_t>(allocator.Allocate(sizeof(*buckets) * bucketCount));
+
+        if constexpr(IsBucketPointer)
+        {
+            (void) ::std::fill_n(buckets, bucketCount, nullptr);
+        }
+        else
+        {
+            (void) ::std::fill_n(buckets, bucketCount, Bucket_t());
+        }
 
+        return buckets;
     }
 
+    void DestroyBucket(::std::remove_pointer_t<BucketArr_t>& bucket) noexcept
+    {
+        DeReference(bucket).Destroy();
+
+        if constexpr(IsBucketPointer)
+        {
+            m_NodeAllocator->DeallocateT(bucket);
+        }
+    }
+private:
     [[nodiscard]] static Bucket_t& DeReference(::std::remove_pointer_t<BucketArr_t>& bucket) noexcept
     {
         if constexpr(IsBucketPointer)
@@ -323,7 +1183,24 @@ private:
         }
     }
 
-    [[nodiscard]] static bool IsTombstone(const ::std::remove_pointer_t<BucketArr_t>& bucket) noexcept
+    /**
+     *   When the buckets are stored by pointer, a deleted bucket is
+     * represented by a pointer that can never be a valid
+     * allocation.
+     */
+    [[nodiscard]] static ::std::remove_pointer_t<BucketArr_t> DeletedPointer() noexcept
+    {
+        if constexpr(IsBucketPointer)
+        {
+            return reinterpret_cast<::std::remove_pointer_t<BucketArr_t>>(static_cast<uPtr>(1));
+        }
+        else
+        {
+            return Bucket_t();
+        }
+    }
+
+    [[nodiscard]] static bool IsEmpty(const ::std::remove_pointer_t<BucketArr_t>& bucket) noexcept
     {
         if constexpr(IsBucketPointer)
         {
@@ -331,7 +1208,61 @@ private:
         }
         else
         {
-            return bucket.HashCode == Bucket_t::TombstoneValue;
+            return bucket.HashCode == Bucket_t::EmptyValue;
+        }
+    }
+
+    [[nodiscard]] static bool IsDeleted(const ::std::remove_pointer_t<BucketArr_t>& bucket) noexcept
+    {
+        if constexpr(IsBucketPointer)
+        {
+            return bucket == DeletedPointer();
+        }
+        else
+        {
+            return bucket.HashCode == Bucket_t::DeletedValue;
+        }
+    }
+
+    [[nodiscard]] static bool IsFull(const ::std::remove_pointer_t<BucketArr_t>& bucket) noexcept
+    {
+        return !IsEmpty(bucket) && !IsDeleted(bucket);
+    }
+
+    static void MarkDeleted(::std::remove_pointer_t<BucketArr_t>& bucket) noexcept
+    {
+        if constexpr(IsBucketPointer)
+        {
+            bucket = DeletedPointer();
+        }
+        else
+        {
+            bucket.HashCode = Bucket_t::DeletedValue;
+        }
+    }
+
+    static void MarkEmpty(::std::remove_pointer_t<BucketArr_t>& bucket) noexcept
+    {
+        if constexpr(IsBucketPointer)
+        {
+            bucket = nullptr;
+        }
+        else
+        {
+            bucket.HashCode = Bucket_t::EmptyValue;
+        }
+    }
+
+    static void SetProbeDistance(::std::remove_pointer_t<BucketArr_t>& bucket, const uSys probeDistance) noexcept
+    {
+        if constexpr(IsLinear)
+        {
+            DeReference(bucket).ProbeDistance = probeDistance;
+        }
+        else
+        {
+            (void) bucket;
+            (void) probeDistance;
         }
     }
 };
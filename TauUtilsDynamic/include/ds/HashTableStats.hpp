@@ -0,0 +1,142 @@
+#pragma once
+
+#include "Objects.hpp"
+#include "NumTypes.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace tau {
+
+enum class HashTableTracking
+{
+    /**
+     * Doesn't record any statistics.
+     */
+    None,
+    /**
+     *   Records the probe length of every insert and lookup, along
+     * with how many times the table was rehashed and how long was
+     * spent doing so.
+     *
+     *   Lookups through a const table also update the statistics,
+     * so a tracking table must not be read from multiple threads
+     * at once.
+     */
+    Probe
+};
+
+/**
+ *   A snapshot of the statistics recorded by a HashTable with
+ * probe tracking enabled.
+ *
+ *   A probe length is the number of buckets inspected beyond the
+ * home bucket. Probe lengths of `HistogramSize - 1` or more are
+ * all counted in the last entry of each histogram.
+ *
+ *   Printing and JSON output are in `ds/HashTableStatsDump.hpp`.
+ */
+struct HashTableStats final
+{
+    static constexpr uSys HistogramSize = 32;
+
+    u64 InsertProbeHistogram[HistogramSize];
+    u64 LookupProbeHistogram[HistogramSize];
+    uSys MaxInsertProbe;
+    uSys MaxLookupProbe;
+    u64 RehashCount;
+    u64 RehashNanoseconds;
+    uSys Count;
+    uSys BucketCount;
+    uSys DeletedCount;
+
+    [[nodiscard]] f64 LoadFactor() const noexcept
+    {
+        return BucketCount == 0 ? 0.0 : static_cast<f64>(Count) / static_cast<f64>(BucketCount);
+    }
+
+    [[nodiscard]] f64 MeanInsertProbe() const noexcept { return MeanProbe(InsertProbeHistogram); }
+    [[nodiscard]] f64 MeanLookupProbe() const noexcept { return MeanProbe(LookupProbeHistogram); }
+
+private:
+    [[nodiscard]] static f64 MeanProbe(const u64 (&histogram)[HistogramSize]) noexcept
+    {
+        u64 total = 0;
+        u64 weighted = 0;
+
+        for(uSys i = 0; i < HistogramSize; ++i)
+        {
+            total += histogram[i];
+            weighted += histogram[i] * i;
+        }
+
+        return total == 0 ? 0.0 : static_cast<f64>(weighted) / static_cast<f64>(total);
+    }
+};
+
+/**
+ *   The base of HashTable which records its statistics. With
+ * tracking disabled every function is a no-op and the base
+ * occupies no space.
+ */
+template<HashTableTracking TrackingT>
+class HashTableStatsRecorder;
+
+template<>
+class HashTableStatsRecorder<HashTableTracking::None>
+{
+    DEFAULT_CONSTRUCT_PO(HashTableStatsRecorder);
+    DEFAULT_DESTRUCT(HashTableStatsRecorder);
+    DEFAULT_CM_PO(HashTableStatsRecorder);
+protected:
+    static void RecordInsertProbe(const uSys probeLength) noexcept { (void) probeLength; }
+    static void RecordLookupProbe(const uSys probeLength) noexcept { (void) probeLength; }
+    [[nodiscard]] static u64 RehashBegin() noexcept { return 0; }
+    static void RehashEnd(const u64 begin) noexcept { (void) begin; }
+    static void MigrateEnd(const u64 begin) noexcept { (void) begin; }
+};
+
+template<>
+class HashTableStatsRecorder<HashTableTracking::Probe>
+{
+    DEFAULT_DESTRUCT(HashTableStatsRecorder);
+    DEFAULT_CM_PO(HashTableStatsRecorder);
+protected:
+    HashTableStatsRecorder() noexcept
+        : m_Stats { }
+    { }
+
+    void RecordInsertProbe(const uSys probeLength) const noexcept
+    {
+        ++m_Stats.InsertProbeHistogram[::std::min(probeLength, HashTableStats::HistogramSize - 1)];
+        m_Stats.MaxInsertProbe = ::std::max(m_Stats.MaxInsertProbe, probeLength);
+    }
+
+    void RecordLookupProbe(const uSys probeLength) const noexcept
+    {
+        ++m_Stats.LookupProbeHistogram[::std::min(probeLength, HashTableStats::HistogramSize - 1)];
+        m_Stats.MaxLookupProbe = ::std::max(m_Stats.MaxLookupProbe, probeLength);
+    }
+
+    [[nodiscard]] static u64 RehashBegin() noexcept
+    {
+        return static_cast<u64>(::std::chrono::duration_cast<::std::chrono::nanoseconds>(::std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    void RehashEnd(const u64 begin) noexcept
+    {
+        ++m_Stats.RehashCount;
+        MigrateEnd(begin);
+    }
+
+    /**
+     * Time spent in an incremental rehash step, this doesn't count as a new rehash.
+     */
+    void MigrateEnd(const u64 begin) noexcept
+    {
+        m_Stats.RehashNanoseconds += RehashBegin() - begin;
+    }
+protected:
+    mutable HashTableStats m_Stats;
+};
+
+}
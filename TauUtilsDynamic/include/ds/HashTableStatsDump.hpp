@@ -0,0 +1,57 @@
+#pragma once
+
+#include "HashTableStats.hpp"
+#include "ConPrinter.hpp"
+#include "json/JsonTypes.hpp"
+
+namespace tau {
+
+/**
+ *   Prints a summary of stats to the console, followed by the non
+ * empty entries of the probe histograms.
+ */
+inline void PrintHashTableStats(const HashTableStats& stats) noexcept
+{
+    ConPrinter::PrintLn(u"Count: {}, Buckets: {}, Deleted: {}, Load Factor: {}", stats.Count, stats.BucketCount, stats.DeletedCount, stats.LoadFactor());
+    ConPrinter::PrintLn(u"Rehashes: {}, Rehash Time: {}ns", stats.RehashCount, stats.RehashNanoseconds);
+    ConPrinter::PrintLn(u"Insert Probe Mean: {}, Max: {}", stats.MeanInsertProbe(), stats.MaxInsertProbe);
+    ConPrinter::PrintLn(u"Lookup Probe Mean: {}, Max: {}", stats.MeanLookupProbe(), stats.MaxLookupProbe);
+    ConPrinter::PrintLn(u"Probe Length, Inserts, Lookups");
+
+    for(uSys i = 0; i < HashTableStats::HistogramSize; ++i)
+    {
+        if(stats.InsertProbeHistogram[i] == 0 && stats.LookupProbeHistogram[i] == 0)
+        {
+            continue;
+        }
+
+        ConPrinter::PrintLn(u"{}{}, {}, {}", i, i == HashTableStats::HistogramSize - 1 ? u"+" : u"", stats.InsertProbeHistogram[i], stats.LookupProbeHistogram[i]);
+    }
+}
+
+/**
+ *   Writes stats as members of object, this can be the root
+ * object or one nested within it.
+ */
+inline void WriteHashTableStatsJson(const HashTableStats& stats, StrongRef<json::JObject>& object) noexcept
+{
+    object->Insert(object, C8DynString(u8"count"), static_cast<u64>(stats.Count));
+    object->Insert(object, C8DynString(u8"bucketCount"), static_cast<u64>(stats.BucketCount));
+    object->Insert(object, C8DynString(u8"deletedCount"), static_cast<u64>(stats.DeletedCount));
+    object->Insert(object, C8DynString(u8"loadFactor"), stats.LoadFactor());
+    object->Insert(object, C8DynString(u8"rehashCount"), stats.RehashCount);
+    object->Insert(object, C8DynString(u8"rehashNanoseconds"), stats.RehashNanoseconds);
+    object->Insert(object, C8DynString(u8"maxInsertProbe"), static_cast<u64>(stats.MaxInsertProbe));
+    object->Insert(object, C8DynString(u8"maxLookupProbe"), static_cast<u64>(stats.MaxLookupProbe));
+
+    StrongRef<json::JArray> insertHistogram = object->InsertArray(object, C8DynString(u8"insertProbeHistogram"));
+    StrongRef<json::JArray> lookupHistogram = object->InsertArray(object, C8DynString(u8"lookupProbeHistogram"));
+
+    for(uSys i = 0; i < HashTableStats::HistogramSize; ++i)
+    {
+        insertHistogram->Append(insertHistogram, stats.InsertProbeHistogram[i]);
+        lookupHistogram->Append(lookupHistogram, stats.LookupProbeHistogram[i]);
+    }
+}
+
+}
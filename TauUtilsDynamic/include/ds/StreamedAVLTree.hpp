@@ -18,8 +18,38 @@ class StreamedAVLTreeAllocator final
 public:
     static constexpr IndexT INVALID_VALUE = static_cast<IndexT>(-1);
     static constexpr IndexT DESTROYED_VALUE = static_cast<IndexT>(0xCCCCCCCCCCCCCCCC);
+private:
+    /**
+     *   Occupies the first page of a file backed allocator, followed
+     * by the left, right, height, and value arrays. The allocator
+     * state is only written back on `Flush` and destruction.
+     *
+     *   The element sizes and reserved page counts determine where
+     * each array starts, a file is only reused when they match.
+     */
+    struct FileHeader final
+    {
+        static constexpr u64 MagicValue = 0x3256415344455254; // "TREDSAV2"
+
+        u64 Magic;
+        u64 ValueSize;
+        u64 IndexSize;
+        u64 HeightSize;
+        u64 AllocPages;
+        u64 BranchReservedPages;
+        u64 HeightReservedPages;
+        u64 ValueReservedPages;
+        u64 AllocIndex;
+        u64 FirstFree;
+        u64 LastFree;
+        u64 BranchCommittedPages;
+        u64 HeightCommittedPages;
+        u64 ValueCommittedPages;
+        u64 Root;
+    };
 private:
     uSys m_AllocPages;
+    PageKind m_PageKind;
 
     uSys m_BranchReservedPages;
     uSys m_HeightReservedPages;
@@ -37,9 +67,12 @@ private:
     IndexT* m_RightTree;
     HeightT* m_HeightTree;
     T* m_ValueTree;
+
+    FileHeader* m_FileHeader;
 public:
-    StreamedAVLTreeAllocator(const uSys maxElements, const uSys allocPages = 4) noexcept
+    StreamedAVLTreeAllocator(const uSys maxElements, const uSys allocPages = 4, const PageKind pageKind = PageKind::Normal) noexcept
         : m_AllocPages(nextPowerOf2(allocPages))
+        , m_PageKind(pageKind)
         , m_BranchReservedPages(AlignTo((maxElements * sizeof(IndexT)) / PageAllocator::PageSize() + 1, m_AllocPages))
         , m_HeightReservedPages(AlignTo((maxElements * sizeof(HeightT)) / PageAllocator::PageSize() + 1, m_AllocPages))
         , m_ValueReservedPages(AlignTo((maxElements * sizeof(T)) / PageAllocator::PageSize() + 1, m_AllocPages))
@@ -49,18 +82,125 @@ public:
         , m_AllocIndex(0)
         , m_FirstFree(INVALID_VALUE)
         , m_LastFree(INVALID_VALUE)
-        , m_LeftTree(reinterpret_cast<IndexT*>(PageAllocator::Reserve(m_BranchReservedPages)))
-        , m_RightTree(reinterpret_cast<IndexT*>(PageAllocator::Reserve(m_BranchReservedPages)))
-        , m_HeightTree(reinterpret_cast<HeightT*>(PageAllocator::Reserve(m_HeightReservedPages)))
-        , m_ValueTree(reinterpret_cast<T*>(PageAllocator::Reserve(m_ValueReservedPages)))
+        , m_LeftTree(reinterpret_cast<IndexT*>(PageAllocator::Reserve(m_BranchReservedPages, m_PageKind)))
+        , m_RightTree(reinterpret_cast<IndexT*>(PageAllocator::Reserve(m_BranchReservedPages, m_PageKind)))
+        , m_HeightTree(reinterpret_cast<HeightT*>(PageAllocator::Reserve(m_HeightReservedPages, m_PageKind)))
+        , m_ValueTree(reinterpret_cast<T*>(PageAllocator::Reserve(m_ValueReservedPages, m_PageKind)))
+        , m_FileHeader(nullptr)
     { }
 
+    /**
+     *   Persists the arrays in the file at path, reopening them
+     * in place if the file was written by an allocator with the
+     * same maxElements, allocPages and element sizes, any other
+     * file is reinitialized. T must not hold pointers or other
+     * state that is only valid within a single process.
+     */
+    StreamedAVLTreeAllocator(const char* const path, const uSys maxElements, const uSys allocPages = 4) noexcept
+        : m_AllocPages(nextPowerOf2(allocPages))
+        , m_PageKind(PageKind::Normal)
+        , m_BranchReservedPages(AlignTo((maxElements * sizeof(IndexT)) / PageAllocator::PageSize() + 1, m_AllocPages))
+        , m_HeightReservedPages(AlignTo((maxElements * sizeof(HeightT)) / PageAllocator::PageSize() + 1, m_AllocPages))
+        , m_ValueReservedPages(AlignTo((maxElements * sizeof(T)) / PageAllocator::PageSize() + 1, m_AllocPages))
+        , m_BranchCommittedPages(0)
+        , m_HeightCommittedPages(0)
+        , m_ValueCommittedPages(0)
+        , m_AllocIndex(0)
+        , m_FirstFree(INVALID_VALUE)
+        , m_LastFree(INVALID_VALUE)
+        , m_LeftTree(nullptr)
+        , m_RightTree(nullptr)
+        , m_HeightTree(nullptr)
+        , m_ValueTree(nullptr)
+        , m_FileHeader(nullptr)
+    {
+        uSys existingBytes;
+        u8* const file = static_cast<u8*>(PageAllocator::ReserveFile(path, FilePageCount(), &existingBytes));
+
+        if(!file)
+        { return; }
+
+        const uSys pageSize = PageAllocator::PageSize();
+
+        m_FileHeader = reinterpret_cast<FileHeader*>(file);
+        m_LeftTree = reinterpret_cast<IndexT*>(file + pageSize);
+        m_RightTree = reinterpret_cast<IndexT*>(file + (1 + m_BranchReservedPages) * pageSize);
+        m_HeightTree = reinterpret_cast<HeightT*>(file + (1 + 2 * m_BranchReservedPages) * pageSize);
+        m_ValueTree = reinterpret_cast<T*>(file + (1 + 2 * m_BranchReservedPages + m_HeightReservedPages) * pageSize);
+
+        (void) PageAllocator::CommitPage(m_FileHeader);
+
+        if(existingBytes < FilePageCount() * pageSize || !IsHeaderValid())
+        {
+            m_FileHeader->Magic = FileHeader::MagicValue;
+            m_FileHeader->ValueSize = sizeof(T);
+            m_FileHeader->IndexSize = sizeof(IndexT);
+            m_FileHeader->HeightSize = sizeof(HeightT);
+            m_FileHeader->AllocPages = m_AllocPages;
+            m_FileHeader->BranchReservedPages = m_BranchReservedPages;
+            m_FileHeader->HeightReservedPages = m_HeightReservedPages;
+            m_FileHeader->ValueReservedPages = m_ValueReservedPages;
+            m_FileHeader->Root = INVALID_VALUE;
+            Flush();
+            return;
+        }
+
+        m_AllocIndex = static_cast<uSys>(m_FileHeader->AllocIndex);
+        m_FirstFree = static_cast<uSys>(m_FileHeader->FirstFree);
+        m_LastFree = static_cast<uSys>(m_FileHeader->LastFree);
+        m_BranchCommittedPages = CommittedPagesToRestore(m_FileHeader->BranchCommittedPages, m_BranchReservedPages, sizeof(IndexT));
+        m_HeightCommittedPages = CommittedPagesToRestore(m_FileHeader->HeightCommittedPages, m_HeightReservedPages, sizeof(HeightT));
+        m_ValueCommittedPages = CommittedPagesToRestore(m_FileHeader->ValueCommittedPages, m_ValueReservedPages, sizeof(T));
+
+        (void) PageAllocator::CommitPages(m_LeftTree, m_BranchCommittedPages);
+        (void) PageAllocator::CommitPages(m_RightTree, m_BranchCommittedPages);
+        (void) PageAllocator::CommitPages(m_HeightTree, m_HeightCommittedPages);
+        (void) PageAllocator::CommitPages(m_ValueTree, m_ValueCommittedPages);
+    }
+
     ~StreamedAVLTreeAllocator() noexcept
     {
-        PageAllocator::Free(m_LeftTree);
-        PageAllocator::Free(m_RightTree);
-        PageAllocator::Free(m_HeightTree);
-        PageAllocator::Free(m_ValueTree);
+        if(m_FileHeader)
+        {
+            StoreHeader();
+            PageAllocator::FreeFile(m_FileHeader, FilePageCount());
+            return;
+        }
+
+        PageAllocator::Free(m_LeftTree, m_BranchReservedPages, m_PageKind);
+        PageAllocator::Free(m_RightTree, m_BranchReservedPages, m_PageKind);
+        PageAllocator::Free(m_HeightTree, m_HeightReservedPages, m_PageKind);
+        PageAllocator::Free(m_ValueTree, m_ValueReservedPages, m_PageKind);
+    }
+
+    [[nodiscard]] bool IsFileBacked() const noexcept { return m_FileHeader != nullptr; }
+
+    /**
+     *   The root stored by `PersistRoot`, this is INVALID_VALUE for
+     * new files and allocators which aren't file backed.
+     */
+    [[nodiscard]] IndexT PersistedRoot() const noexcept { return m_FileHeader ? static_cast<IndexT>(m_FileHeader->Root) : INVALID_VALUE; }
+
+    void PersistRoot(const IndexT root) noexcept
+    {
+        if(m_FileHeader)
+        { m_FileHeader->Root = root; }
+    }
+
+    /**
+     * Writes the allocator state and every committed page to the file.
+     */
+    void Flush() noexcept
+    {
+        if(!m_FileHeader)
+        { return; }
+
+        StoreHeader();
+        PageAllocator::FlushPages(m_FileHeader, 1);
+        PageAllocator::FlushPages(m_LeftTree, m_BranchCommittedPages);
+        PageAllocator::FlushPages(m_RightTree, m_BranchCommittedPages);
+        PageAllocator::FlushPages(m_HeightTree, m_HeightCommittedPages);
+        PageAllocator::FlushPages(m_ValueTree, m_ValueCommittedPages);
     }
 
     [[nodiscard]] IndexT*    LeftTree() noexcept { return m_LeftTree;   }
@@ -125,11 +265,66 @@ public:
         m_LastFree = index;
     }
 private:
+    [[nodiscard]] uSys FilePageCount() const noexcept { return 1 + 2 * m_BranchReservedPages + m_HeightReservedPages + m_ValueReservedPages; }
+
+    /**
+     *   Whether the header was written by an allocator with the same
+     * layout, and its allocation state fits within the arrays.
+     */
+    [[nodiscard]] bool IsHeaderValid() const noexcept
+    {
+        const FileHeader& header = *m_FileHeader;
+
+        if(header.Magic != FileHeader::MagicValue ||
+           header.ValueSize != sizeof(T) ||
+           header.IndexSize != sizeof(IndexT) ||
+           header.HeightSize != sizeof(HeightT) ||
+           header.AllocPages != m_AllocPages ||
+           header.BranchReservedPages != m_BranchReservedPages ||
+           header.HeightReservedPages != m_HeightReservedPages ||
+           header.ValueReservedPages != m_ValueReservedPages)
+        { return false; }
+
+        const uSys pageSize = PageAllocator::PageSize();
+        const uSys capacity = minT(m_BranchReservedPages * pageSize / sizeof(IndexT), m_HeightReservedPages * pageSize / sizeof(HeightT), m_ValueReservedPages * pageSize / sizeof(T));
+
+        if(header.AllocIndex > capacity)
+        { return false; }
+
+        if(header.Root != INVALID_VALUE && header.Root >= header.AllocIndex)
+        { return false; }
+
+        if((header.FirstFree == INVALID_VALUE) != (header.LastFree == INVALID_VALUE))
+        { return false; }
+
+        return header.FirstFree == INVALID_VALUE || (header.FirstFree < header.AllocIndex && header.LastFree < header.AllocIndex);
+    }
+
+    /**
+     *   A stored committed page count, kept within the reservation
+     * and grown to cover every allocated element.
+     */
+    [[nodiscard]] uSys CommittedPagesToRestore(const u64 stored, const uSys reservedPages, const uSys elementSize) const noexcept
+    {
+        const uSys required = AlignTo(DivCeil(m_AllocIndex * elementSize, PageAllocator::PageSize()), m_AllocPages);
+        return minT(maxT(AlignTo(static_cast<uSys>(stored), m_AllocPages), required), reservedPages);
+    }
+
+    void StoreHeader() noexcept
+    {
+        m_FileHeader->AllocIndex = m_AllocIndex;
+        m_FileHeader->FirstFree = m_FirstFree;
+        m_FileHeader->LastFree = m_LastFree;
+        m_FileHeader->BranchCommittedPages = m_BranchCommittedPages;
+        m_FileHeader->HeightCommittedPages = m_HeightCommittedPages;
+        m_FileHeader->ValueCommittedPages = m_ValueCommittedPages;
+    }
+
     [[nodiscard]] bool AssertSize() noexcept
     {
         {
             const uSys branchPageBytes = m_BranchCommittedPages * PageAllocator::PageSize();
-            if(m_AllocIndex + sizeof(IndexT) > branchPageBytes)
+            if((m_AllocIndex + 1) * sizeof(IndexT) > branchPageBytes)
             {
                 if(m_BranchCommittedPages == m_BranchReservedPages)
                 { return false; }
@@ -142,7 +337,7 @@ private:
 
         {
             const uSys heightPageBytes = m_HeightCommittedPages * PageAllocator::PageSize();
-            if(m_AllocIndex + sizeof(HeightT) > heightPageBytes)
+            if((m_AllocIndex + 1) * sizeof(HeightT) > heightPageBytes)
             {
                 if(m_HeightCommittedPages == m_HeightReservedPages)
                 { return false; }
@@ -154,7 +349,7 @@ private:
 
         {
             const uSys valuePageBytes = m_ValueCommittedPages * PageAllocator::PageSize();
-            if(m_AllocIndex + sizeof(T) > valuePageBytes)
+            if((m_AllocIndex + 1) * sizeof(T) > valuePageBytes)
             {
                 if(m_ValueCommittedPages == m_ValueReservedPages)
                 { return false; }
@@ -217,13 +412,37 @@ private:
 
     IndexT m_Root;
 public:
-    StreamedAVLTree(const uSys maxElements) noexcept
-        : m_Allocator(maxElements)
+    StreamedAVLTree(const uSys maxElements, const PageKind pageKind = PageKind::Normal) noexcept
+        : m_Allocator(maxElements, 4, pageKind)
         , m_Root(INVALID_VALUE)
     { }
 
+    /**
+     *   Opens a tree persisted in the file at path, see the file
+     * backed constructor of `StreamedAVLTreeAllocator`. The tree
+     * is kept, rather than disposed, when this is destroyed.
+     */
+    StreamedAVLTree(const char* const path, const uSys maxElements) noexcept
+        : m_Allocator(path, maxElements)
+        , m_Root(m_Allocator.PersistedRoot())
+    { }
+
     ~StreamedAVLTree() noexcept
-    { DisposeTree(); }
+    {
+        if(m_Allocator.IsFileBacked())
+        { m_Allocator.PersistRoot(m_Root); }
+        else
+        { DisposeTree(); }
+    }
+
+    /**
+     * Writes a file backed tree to its file.
+     */
+    void Flush() noexcept
+    {
+        m_Allocator.PersistRoot(m_Root);
+        m_Allocator.Flush();
+    }
 
     [[nodiscard]] IndexT Root() const noexcept { return m_Root; }
 
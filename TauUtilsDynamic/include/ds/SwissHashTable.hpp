@@ -0,0 +1,507 @@
+#pragma once
+
+#include "Objects.hpp"
+#include "NumTypes.hpp"
+#include "TUMaths.hpp"
+#include "allocator/TauAllocator.hpp"
+#include "HashTable.hpp"
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <memory>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define TAU_SWISS_USE_SSE2 1
+  #pragma warning(push, 0)
+  #include <emmintrin.h>
+  #pragma warning(pop)
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+  #define TAU_SWISS_USE_NEON 1
+  #pragma warning(push, 0)
+  #include <arm_neon.h>
+  #pragma warning(pop)
+#endif
+
+namespace tau::swiss {
+
+/**
+ *   The control byte of a slot that has never held a value.
+ * Probing stops at the first group containing one of these.
+ */
+static constexpr u8 CtrlEmpty = 0x80;
+/**
+ *   The control byte of a slot whose value has been removed.
+ * Probing continues past these, but they can be reused by an
+ * insertion.
+ */
+static constexpr u8 CtrlDeleted = 0xFE;
+
+/**
+ *   A full slot stores the low 7 bits of the mixed hash in its
+ * control byte, the high bit is always clear.
+ */
+[[nodiscard]] inline constexpr bool IsFull(const u8 ctrl) noexcept
+{ return (ctrl & 0x80) == 0; }
+
+/**
+ *   A set of matched slots within a group.
+ *
+ *   Each matching slot is represented by a single set bit,
+ * `Shift` is used to convert the bit index into a slot index,
+ * this allows the NEON and portable implementations to use
+ * nibble and byte wide masks respectively.
+ */
+template<typename MaskT, u32 Shift>
+class BitMask final
+{
+    DEFAULT_DESTRUCT(BitMask);
+    DEFAULT_CM_PU(BitMask);
+public:
+    explicit BitMask(const MaskT mask) noexcept
+        : m_Mask(mask)
+    { }
+
+    [[nodiscard]] uSys LowestIndex() const noexcept
+    { return static_cast<uSys>(CountTrailingZero(m_Mask)) >> Shift; }
+
+    void ClearLowest() noexcept
+    { m_Mask &= m_Mask - 1; }
+
+    [[nodiscard]] explicit operator bool() const noexcept { return m_Mask != 0; }
+private:
+    MaskT m_Mask;
+};
+
+#if defined(TAU_SWISS_USE_SSE2)
+
+/**
+ * Matches 16 control bytes at a time using SSE2.
+ */
+class Group final
+{
+    DEFAULT_DESTRUCT(Group);
+    DEFAULT_CM_PU(Group);
+public:
+    static constexpr uSys Width = 16;
+
+    using Mask_t = BitMask<u32, 0>;
+public:
+    explicit Group(const u8* const ctrl) noexcept
+        : m_Ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+    { }
+
+    [[nodiscard]] Mask_t Match(const u8 h2) const noexcept
+    { return Mask_t(static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), m_Ctrl)))); }
+
+    [[nodiscard]] Mask_t MatchEmpty() const noexcept
+    { return Match(CtrlEmpty); }
+
+    [[nodiscard]] Mask_t MatchEmptyOrDeleted() const noexcept
+    { return Mask_t(static_cast<u32>(_mm_movemask_epi8(m_Ctrl))); }
+private:
+    __m128i m_Ctrl;
+};
+
+#elif defined(TAU_SWISS_USE_NEON)
+
+/**
+ *   Matches 16 control bytes at a time using NEON.
+ *
+ *   NEON has no movemask, instead the comparison result is
+ * narrowed to a nibble per byte, and only the high bit of each
+ * nibble is kept.
+ */
+class Group final
+{
+    DEFAULT_DESTRUCT(Group);
+    DEFAULT_CM_PU(Group);
+public:
+    static constexpr uSys Width = 16;
+
+    using Mask_t = BitMask<u64, 2>;
+public:
+    explicit Group(const u8* const ctrl) noexcept
+        : m_Ctrl(vld1q_u8(ctrl))
+    { }
+
+    [[nodiscard]] Mask_t Match(const u8 h2) const noexcept
+    { return Narrow(vceqq_u8(vdupq_n_u8(h2), m_Ctrl)); }
+
+    [[nodiscard]] Mask_t MatchEmpty() const noexcept
+    { return Match(CtrlEmpty); }
+
+    [[nodiscard]] Mask_t MatchEmptyOrDeleted() const noexcept
+    { return Narrow(vcltq_s8(vreinterpretq_s8_u8(m_Ctrl), vdupq_n_s8(0))); }
+private:
+    [[nodiscard]] static Mask_t Narrow(const uint8x16_t mask) noexcept
+    {
+        const uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(mask), 4);
+        return Mask_t(vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ull);
+    }
+private:
+    uint8x16_t m_Ctrl;
+};
+
+#else
+
+/**
+ *   Matches 8 control bytes at a time using regular 64 bit
+ * integer arithmetic.
+ *
+ *   `Match` can report a false positive for a full slot
+ * directly following a true match, this is fine as the key is
+ * always compared afterwards.
+ */
+class Group final
+{
+    DEFAULT_DESTRUCT(Group);
+    DEFAULT_CM_PU(Group);
+public:
+    static constexpr uSys Width = 8;
+
+    using Mask_t = BitMask<u64, 3>;
+private:
+    static constexpr u64 Lsbs = 0x0101010101010101ull;
+    static constexpr u64 Msbs = 0x8080808080808080ull;
+public:
+    explicit Group(const u8* const ctrl) noexcept
+        : m_Ctrl(0)
+    {
+        (void) ::std::memcpy(&m_Ctrl, ctrl, sizeof(m_Ctrl));
+
+        if constexpr(::std::endian::native == ::std::endian::big)
+        {
+            u64 swapped = 0;
+            for(uSys i = 0; i < sizeof(m_Ctrl); ++i)
+            {
+                swapped |= ((m_Ctrl >> (i * 8)) & 0xFF) << ((sizeof(m_Ctrl) - 1 - i) * 8);
+            }
+            m_Ctrl = swapped;
+        }
+    }
+
+    [[nodiscard]] Mask_t Match(const u8 h2) const noexcept
+    {
+        const u64 x = m_Ctrl ^ (Lsbs * h2);
+        return Mask_t((x - Lsbs) & ~x & Msbs);
+    }
+
+    [[nodiscard]] Mask_t MatchEmpty() const noexcept
+    { return Mask_t(m_Ctrl & ~(m_Ctrl << 6) & Msbs); }
+
+    [[nodiscard]] Mask_t MatchEmptyOrDeleted() const noexcept
+    { return Mask_t(m_Ctrl & Msbs); }
+private:
+    u64 m_Ctrl;
+};
+
+#endif
+
+}
+
+namespace tau {
+
+/**
+ *   An open addressing hash table which keeps a separate array
+ * of 1 byte control tags in front of the buckets.
+ *
+ *   Each control byte is either empty, deleted, or holds 7 bits
+ * of the hash for a full slot. Lookups load an entire group of
+ * control bytes (16 with SSE2 or NEON, 8 otherwise) and match
+ * them all at once, only touching the buckets for slots whose
+ * tag matches. This means a miss generally only costs one or
+ * two cache lines of control bytes, regardless of the size of
+ * the keys and values.
+ *
+ *   Groups are probed triangularly, the group count is always a
+ * power of 2, which guarantees every group is visited. The table
+ * grows once 7/8 of the slots have been used.
+ *
+ *   Unlike `HashTable` inserting an existing key replaces its
+ * value.
+ *
+ *   Removed slots become tombstones, unless their group still
+ * has an empty slot. Tombstones are reclaimed by rehashing in
+ * place when the table fills up while less than half of it is
+ * live.
+ */
+template<typename KeyT, typename ValueT>
+class SwissHashTable final
+{
+    DELETE_CM(SwissHashTable);
+public:
+    using Group_t = swiss::Group;
+    static constexpr uSys GroupWidth = Group_t::Width;
+private:
+    using Bucket_t = HashBucket<KeyT, ValueT>;
+private:
+    TauAllocator* m_ArrayAllocator;
+    uSys m_GroupMask;
+    uSys m_Capacity;
+    uSys m_ActiveElementCount;
+    uSys m_GrowthLeft;
+    u8* m_Ctrl;
+    Bucket_t* m_Buckets;
+public:
+    SwissHashTable(
+        const uSys minCount = 1,
+        TauAllocator& arrayAllocator = DefaultTauAllocator::Instance()
+    ) noexcept
+        : m_ArrayAllocator(&arrayAllocator)
+        , m_GroupMask(0)
+        , m_Capacity(0)
+        , m_ActiveElementCount(0)
+        , m_GrowthLeft(0)
+        , m_Ctrl(nullptr)
+        , m_Buckets(nullptr)
+    {
+        // Reserve enough slots that minCount elements fit under the max load factor.
+        const uSys minCapacity = minCount + minCount / 7 + 1;
+        AllocateArrays(nextPowerOf2(DivCeil(minCapacity, GroupWidth)));
+    }
+
+    ~SwissHashTable() noexcept
+    {
+        DestroyBuckets();
+        m_ArrayAllocator->Deallocate(m_Ctrl);
+    }
+
+    [[nodiscard]] uSys Count() const noexcept { return m_ActiveElementCount; }
+    [[nodiscard]] uSys Capacity() const noexcept { return m_Capacity; }
+
+    void Insert(const KeyT& key, const ValueT& value) noexcept
+    { InternalInsert(key, value); }
+
+    void Insert(const KeyT& key, ValueT&& value) noexcept
+    { InternalInsert(key, ::std::move(value)); }
+
+    [[nodiscard]] bool Contains(const KeyT& key) const noexcept
+    { return Find(key, ::std::hash<KeyT> {}(key)) != nullptr; }
+
+    [[nodiscard]] ValueT* Get(const KeyT& key) noexcept
+    {
+        Bucket_t* const bucket = Find(key, ::std::hash<KeyT> {}(key));
+        return bucket ? bucket->ValuePtr() : nullptr;
+    }
+
+    [[nodiscard]] const ValueT* Get(const KeyT& key) const noexcept
+    { return const_cast<SwissHashTable<KeyT, ValueT>*>(this)->Get(key); }
+
+    /**
+     *   Removes the entry for key, destroying both the key and the
+     * value.
+     *
+     *   If the group the slot belongs to still has an empty slot no
+     * probe sequence can have continued past this group, thus
+     * the slot can be marked as empty again, otherwise it becomes
+     * a tombstone which is reclaimed on the next rehash.
+     *
+     * @return
+     *      Whether the key was present.
+     */
+    bool Remove(const KeyT& key) noexcept
+    {
+        Bucket_t* const bucket = Find(key, ::std::hash<KeyT> {}(key));
+
+        if(!bucket)
+        {
+            return false;
+        }
+
+        const uSys index = static_cast<uSys>(bucket - m_Buckets);
+        const uSys groupBase = index & ~(GroupWidth - 1);
+
+        bucket->Destroy();
+        --m_ActiveElementCount;
+
+        if(Group_t(m_Ctrl + groupBase).MatchEmpty())
+        {
+            m_Ctrl[index] = swiss::CtrlEmpty;
+            ++m_GrowthLeft;
+        }
+        else
+        {
+            m_Ctrl[index] = swiss::CtrlDeleted;
+        }
+
+        return true;
+    }
+private:
+    template<typename ValueArgT>
+    void InternalInsert(const KeyT& key, ValueArgT&& value) noexcept
+    {
+        const uSys hashCode = ::std::hash<KeyT> {}(key);
+
+        if(Bucket_t* const existing = Find(key, hashCode))
+        {
+            *existing->ValuePtr() = ::std::forward<ValueArgT>(value);
+            return;
+        }
+
+        if(m_GrowthLeft == 0)
+        {
+            Grow();
+        }
+
+        const uSys index = FindInsertSlot(hashCode);
+
+        if(m_Ctrl[index] == swiss::CtrlEmpty)
+        {
+            --m_GrowthLeft;
+        }
+
+        m_Ctrl[index] = H2(hashCode);
+        ++m_ActiveElementCount;
+
+        Bucket_t* const bucket = ::std::construct_at(&m_Buckets[index]);
+        bucket->HashCode = hashCode;
+        ::std::construct_at(bucket->KeyPtr(), key);
+        ::std::construct_at(bucket->ValuePtr(), ::std::forward<ValueArgT>(value));
+    }
+
+    [[nodiscard]] Bucket_t* Find(const KeyT& key, const uSys hashCode) const noexcept
+    {
+        const u8 h2 = H2(hashCode);
+        uSys group = H1(hashCode) & m_GroupMask;
+
+        for(uSys probeIndex = 1; probeIndex <= m_GroupMask + 1; ++probeIndex)
+        {
+            const uSys groupBase = group * GroupWidth;
+            const Group_t ctrl(m_Ctrl + groupBase);
+
+            for(auto match = ctrl.Match(h2); match; match.ClearLowest())
+            {
+                Bucket_t& bucket = m_Buckets[groupBase + match.LowestIndex()];
+
+                if(bucket.HashCode == hashCode && *bucket.KeyPtr() == key)
+                {
+                    return &bucket;
+                }
+            }
+
+            if(ctrl.MatchEmpty())
+            {
+                return nullptr;
+            }
+
+            group = (group + probeIndex) & m_GroupMask;
+        }
+
+        return nullptr;
+    }
+
+    [[nodiscard]] uSys FindInsertSlot(const uSys hashCode) const noexcept
+    {
+        uSys group = H1(hashCode) & m_GroupMask;
+
+        // There is always at least one free slot when this is called, thus this will always terminate.
+        for(uSys probeIndex = 1; true; ++probeIndex)
+        {
+            const uSys groupBase = group * GroupWidth;
+            const auto free = Group_t(m_Ctrl + groupBase).MatchEmptyOrDeleted();
+
+            if(free)
+            {
+                return groupBase + free.LowestIndex();
+            }
+
+            group = (group + probeIndex) & m_GroupMask;
+        }
+    }
+
+    void Grow() noexcept
+    {
+        // If at least half of the used slots are deleted we can just rehash in place to reclaim them.
+        if(m_ActiveElementCount <= MaxLoad(m_Capacity) / 2)
+        {
+            Rehash(m_GroupMask + 1);
+        }
+        else
+        {
+            Rehash((m_GroupMask + 1) * 2);
+        }
+    }
+
+    void Rehash(const uSys groupCount) noexcept
+    {
+        const uSys oldCapacity = m_Capacity;
+        u8* const oldCtrl = m_Ctrl;
+        Bucket_t* const oldBuckets = m_Buckets;
+
+        AllocateArrays(groupCount);
+
+        for(uSys i = 0; i < oldCapacity; ++i)
+        {
+            if(!swiss::IsFull(oldCtrl[i]))
+            {
+                continue;
+            }
+
+            Bucket_t& oldBucket = oldBuckets[i];
+            const uSys index = FindInsertSlot(oldBucket.HashCode);
+            m_Ctrl[index] = H2(oldBucket.HashCode);
+
+            Bucket_t* const bucket = ::std::construct_at(&m_Buckets[index]);
+            bucket->HashCode = oldBucket.HashCode;
+            ::std::construct_at(bucket->KeyPtr(), ::std::move(*oldBucket.KeyPtr()));
+            ::std::construct_at(bucket->ValuePtr(), ::std::move(*oldBucket.ValuePtr()));
+            oldBucket.Destroy();
+        }
+
+        m_GrowthLeft -= m_ActiveElementCount;
+        m_ArrayAllocator->Deallocate(oldCtrl);
+    }
+
+    /**
+     *   Allocates the control bytes and the buckets as a single
+     * block, the buckets are placed directly after the control
+     * bytes.
+     */
+    void AllocateArrays(const uSys groupCount) noexcept
+    {
+        m_GroupMask = groupCount - 1;
+        m_Capacity = groupCount * GroupWidth;
+        m_GrowthLeft = MaxLoad(m_Capacity);
+
+        const uSys bucketOffset = AlignTo(m_Capacity, alignof(Bucket_t));
+
+        m_Ctrl = static_cast<u8*>(m_ArrayAllocator->Allocate(bucketOffset + sizeof(Bucket_t) * m_Capacity));
+        m_Buckets = reinterpret_cast<Bucket_t*>(m_Ctrl + bucketOffset);
+
+        (void) ::std::memset(m_Ctrl, swiss::CtrlEmpty, m_Capacity);
+    }
+
+    void DestroyBuckets() noexcept
+    {
+        for(uSys i = 0; i < m_Capacity; ++i)
+        {
+            if(swiss::IsFull(m_Ctrl[i]))
+            {
+                m_Buckets[i].Destroy();
+            }
+        }
+    }
+private:
+    [[nodiscard]] static constexpr uSys MaxLoad(const uSys capacity) noexcept
+    { return capacity - capacity / 8; }
+
+    /**
+     *   Spreads the entropy of the hash code across the entire
+     * word, many `std::hash` implementations are the identity
+     * function for integers, which would otherwise place every
+     * small key in the first group.
+     */
+    [[nodiscard]] static constexpr uSys MixHash(const uSys hashCode) noexcept
+    {
+        const uSys mixed = hashCode * PowerOfTwoCapacityPolicy::FibonacciMultiplier;
+        return mixed ^ (mixed >> (sizeof(uSys) * 4));
+    }
+
+    [[nodiscard]] static constexpr uSys H1(const uSys hashCode) noexcept
+    { return MixHash(hashCode) >> 7; }
+
+    [[nodiscard]] static constexpr u8 H2(const uSys hashCode) noexcept
+    { return static_cast<u8>(MixHash(hashCode) & 0x7F); }
+};
+
+}
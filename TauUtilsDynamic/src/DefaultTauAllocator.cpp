@@ -4,6 +4,7 @@
 TAU_UTILS_LIB BasicTauAllocator<AllocationTracking::None> BasicTauAllocator<AllocationTracking::None>::s_Instance;
 TAU_UTILS_LIB BasicTauAllocator<AllocationTracking::Count> BasicTauAllocator<AllocationTracking::Count>::s_Instance;
 TAU_UTILS_LIB BasicTauAllocator<AllocationTracking::DoubleDeleteCount> BasicTauAllocator<AllocationTracking::DoubleDeleteCount>::s_Instance;
+TAU_UTILS_LIB BasicTauAllocator<AllocationTracking::Profile> BasicTauAllocator<AllocationTracking::Profile>::s_Instance;
 
 extern "C" TAU_UTILS_LIB void* TauUtilsAllocateNonConst(const uSys size) noexcept
 {
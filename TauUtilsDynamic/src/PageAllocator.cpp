@@ -2,3 +2,6 @@
 
 TAU_UTILS_LIB bool PageAllocator::m_Initialized = false;
 TAU_UTILS_LIB uSys PageAllocator::m_PageSize = 0;
+TAU_UTILS_LIB uSys PageAllocator::m_LargePageSize = 0;
+TAU_UTILS_LIB uSys PageAllocator::m_HugePageSize = 0;
+TAU_UTILS_LIB uSys PageAllocator::m_NumaNodeCount = 1;
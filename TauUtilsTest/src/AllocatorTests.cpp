@@ -0,0 +1,1329 @@
+#include <allocator/FixedBlockAllocator.hpp>
+#include <allocator/PageAllocator.hpp>
+#include <allocator/ConcurrentFixedBlockAllocator.hpp>
+#include <allocator/ThreadCachingBlockAllocator.hpp>
+#include <allocator/NodeLocalBlockAllocator.hpp>
+#include <allocator/LinearArenaAllocator.hpp>
+#include <allocator/ConcurrentRingAllocator.hpp>
+#include <allocator/AllocationProfileDump.hpp>
+#include <allocator/TauStdAllocator.hpp>
+#include <allocator/SizeClassAllocator.hpp>
+#include <ArrayList.hpp>
+#include <ds/StreamedAVLTree.hpp>
+#include <ConPrinter.hpp>
+#include <TauUnit.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+static void ThreadCachingReuseTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys BlockCount = 1000;
+
+    ::tau::allocator::ThreadCachingBlockAllocator<16> allocator(sizeof(uSys), BlockCount);
+
+    ::std::vector<void*> blocks(BlockCount);
+
+    uSys nullCount = 0;
+
+    for(uSys i = 0; i < BlockCount; ++i)
+    {
+        blocks[i] = allocator.Allocate(sizeof(uSys));
+
+        if(!blocks[i])
+        {
+            ++nullCount;
+            continue;
+        }
+
+        *static_cast<uSys*>(blocks[i]) = i;
+    }
+
+    TAU_UNIT_EQ(nullCount, 0, u8"Failed to allocate blocks within the reservation.");
+
+    uSys corruptCount = 0;
+
+    for(uSys i = 0; i < BlockCount; ++i)
+    {
+        if(blocks[i] && *static_cast<uSys*>(blocks[i]) != i)
+        {
+            ++corruptCount;
+        }
+
+        allocator.Deallocate(blocks[i]);
+    }
+
+    TAU_UNIT_EQ(corruptCount, 0, u8"Blocks were handed out more than once.");
+
+    // Every block should come back out of the magazines and depot rather than the pool.
+    uSys reusedCount = 0;
+
+    for(uSys i = 0; i < BlockCount; ++i)
+    {
+        void* const block = allocator.Allocate(sizeof(uSys));
+
+        if(::std::find(blocks.begin(), blocks.end(), block) != blocks.end())
+        {
+            ++reusedCount;
+        }
+    }
+
+    TAU_UNIT_EQ(reusedCount, BlockCount, u8"Freed blocks were not reused.");
+    TAU_UNIT_EQ(allocator.Allocate(sizeof(uSys) + 1), nullptr, u8"Allocated a block larger than the block size.");
+}
+
+static void ThreadCachingMultiThreadTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys ThreadCount = 4;
+    constexpr uSys RoundCount = 2000;
+    constexpr uSys BatchSize = 48;
+
+    ::tau::allocator::ThreadCachingBlockAllocator<16> allocator(sizeof(uSys) * 2, ThreadCount * BatchSize * 4);
+
+    ::std::mutex handoffMutex;
+    ::std::vector<void*> handoff;
+    ::std::atomic<uSys> corruptCount(0);
+    ::std::atomic<uSys> nullCount(0);
+
+    const auto worker = [&](const uSys threadIndex)
+    {
+        void* blocks[BatchSize];
+
+        for(uSys round = 0; round < RoundCount; ++round)
+        {
+            const uSys tag = threadIndex * RoundCount + round;
+
+            for(uSys i = 0; i < BatchSize; ++i)
+            {
+                blocks[i] = allocator.Allocate(sizeof(uSys) * 2);
+
+                if(!blocks[i])
+                {
+                    nullCount.fetch_add(1, ::std::memory_order_relaxed);
+                    continue;
+                }
+
+                static_cast<uSys*>(blocks[i])[0] = tag;
+                static_cast<uSys*>(blocks[i])[1] = i;
+            }
+
+            for(uSys i = 0; i < BatchSize; ++i)
+            {
+                if(blocks[i] && (static_cast<uSys*>(blocks[i])[0] != tag || static_cast<uSys*>(blocks[i])[1] != i))
+                {
+                    corruptCount.fetch_add(1, ::std::memory_order_relaxed);
+                }
+            }
+
+            // Free a quarter of each batch from a different thread.
+            {
+                ::std::lock_guard lock(handoffMutex);
+
+                for(void* const block : handoff)
+                {
+                    allocator.Deallocate(block);
+                }
+
+                handoff.assign(blocks, blocks + BatchSize / 4);
+            }
+
+            for(uSys i = BatchSize / 4; i < BatchSize; ++i)
+            {
+                allocator.Deallocate(blocks[i]);
+            }
+        }
+    };
+
+    ::std::vector<::std::thread> threads;
+
+    for(uSys i = 0; i < ThreadCount; ++i)
+    {
+        threads.emplace_back(worker, i);
+    }
+
+    for(::std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    for(void* const block : handoff)
+    {
+        allocator.Deallocate(block);
+    }
+
+    TAU_UNIT_EQ(nullCount.load(), 0, u8"Ran out of blocks, exited threads did not return their caches.");
+    TAU_UNIT_EQ(corruptCount.load(), 0, u8"A block was owned by two threads at once.");
+}
+
+static void ConcurrentFixedBlockCrossThreadTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys ProducerCount = 2;
+    constexpr uSys ConsumerCount = 2;
+    constexpr uSys MessageCount = 20000;
+    constexpr uSys MaxInFlight = 64;
+
+    ::tau::allocator::ConcurrentFixedBlockAllocator<AllocationTracking::Count> allocator(sizeof(uSys) * 2, ProducerCount * MaxInFlight * 2);
+
+    ::std::mutex queueMutex;
+    ::std::vector<void*> queue;
+    ::std::atomic<uSys> producedCount(0);
+    ::std::atomic<uSys> consumedCount(0);
+    ::std::atomic<uSys> corruptCount(0);
+    ::std::atomic<uSys> nullCount(0);
+
+    const auto producer = [&](const uSys producerIndex)
+    {
+        for(uSys i = 0; i < MessageCount; ++i)
+        {
+            void* const block = allocator.Allocate(sizeof(uSys) * 2);
+
+            if(!block)
+            {
+                nullCount.fetch_add(1, ::std::memory_order_relaxed);
+                continue;
+            }
+
+            static_cast<uSys*>(block)[0] = producerIndex;
+            static_cast<uSys*>(block)[1] = ~producerIndex;
+
+            while(true)
+            {
+                {
+                    ::std::lock_guard lock(queueMutex);
+
+                    if(queue.size() < MaxInFlight)
+                    {
+                        queue.push_back(block);
+                        break;
+                    }
+                }
+
+                ::std::this_thread::yield();
+            }
+
+            producedCount.fetch_add(1, ::std::memory_order_relaxed);
+        }
+    };
+
+    const auto consumer = [&]()
+    {
+        while(consumedCount.load(::std::memory_order_relaxed) + nullCount.load(::std::memory_order_relaxed) < ProducerCount * MessageCount)
+        {
+            void* block = nullptr;
+
+            {
+                ::std::lock_guard lock(queueMutex);
+
+                if(!queue.empty())
+                {
+                    block = queue.back();
+                    queue.pop_back();
+                }
+            }
+
+            if(!block)
+            {
+                ::std::this_thread::yield();
+                continue;
+            }
+
+            if(static_cast<uSys*>(block)[0] != ~static_cast<uSys*>(block)[1])
+            {
+                corruptCount.fetch_add(1, ::std::memory_order_relaxed);
+            }
+
+            allocator.Deallocate(block);
+            consumedCount.fetch_add(1, ::std::memory_order_relaxed);
+        }
+    };
+
+    ::std::vector<::std::thread> threads;
+
+    for(uSys i = 0; i < ProducerCount; ++i)
+    {
+        threads.emplace_back(producer, i);
+    }
+
+    for(uSys i = 0; i < ConsumerCount; ++i)
+    {
+        threads.emplace_back(consumer);
+    }
+
+    for(::std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    TAU_UNIT_EQ(nullCount.load(), 0, u8"Ran out of blocks, freed blocks were not reused.");
+    TAU_UNIT_EQ(corruptCount.load(), 0, u8"A block was handed out while still in use.");
+    TAU_UNIT_EQ(consumedCount.load(), ProducerCount * MessageCount, u8"Not every message was consumed.");
+    TAU_UNIT_EQ(allocator.allocationDifference(), 0, u8"Allocations and deallocations did not balance.");
+}
+
+static void ConcurrentFixedBlockDoubleDeleteTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    ::tau::allocator::ConcurrentFixedBlockAllocator<AllocationTracking::DoubleDeleteCount> allocator(13, static_cast<uSys>(16));
+
+    void* const first = allocator.Allocate(13);
+    void* const second = allocator.Allocate(13);
+
+    TAU_UNIT_EQ(reinterpret_cast<uPtr>(first) % sizeof(void*), 0, u8"Blocks were not pointer aligned.");
+
+    allocator.Deallocate(first);
+    allocator.Deallocate(first);
+    allocator.Deallocate(second);
+    allocator.Deallocate(second);
+    allocator.Deallocate(second);
+
+    TAU_UNIT_EQ(allocator.doubleDeleteCount(), 2, u8"Double deletes were not counted.");
+    TAU_UNIT_EQ(allocator.multipleDeleteCount(), 3, u8"Multiple deletes were not counted.");
+
+    // The extra deletes must not have pushed the blocks twice.
+    void* const third = allocator.Allocate(13);
+    void* const fourth = allocator.Allocate(13);
+
+    TAU_UNIT_NEQ(third, fourth, u8"A double deleted block was handed out twice.");
+
+    // Far more address space than any system has.
+    constexpr uSys UnreservableElements = (static_cast<uSys>(1) << 60) / 64;
+    ::tau::allocator::ConcurrentFixedBlockAllocator<> unreserved(64, UnreservableElements);
+
+    TAU_UNIT_EQ(unreserved.Allocate(64), nullptr, u8"Allocated from an allocator whose reservation failed.");
+    TAU_UNIT_EQ(unreserved.Allocate(64), nullptr, u8"Allocated from an allocator whose reservation failed.");
+
+    ::tau::allocator::NodeLocalBlockAllocator<> unreservedNodes(64, UnreservableElements);
+
+    TAU_UNIT_EQ(unreservedNodes.Allocate(64), nullptr, u8"Allocated from node arenas whose reservations failed.");
+}
+
+static void BlockAllocatorPerfTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys ThreadCount = 4;
+    constexpr uSys RoundCount = 20000;
+    constexpr uSys BatchSize = 32;
+
+    const auto run = [](auto&& allocate, auto&& deallocate)
+    {
+        const auto worker = [&]()
+        {
+            void* blocks[BatchSize];
+
+            for(uSys round = 0; round < RoundCount; ++round)
+            {
+                for(uSys i = 0; i < BatchSize; ++i)
+                {
+                    blocks[i] = allocate();
+                }
+
+                for(uSys i = 0; i < BatchSize; ++i)
+                {
+                    deallocate(blocks[i]);
+                }
+            }
+        };
+
+        const auto begin = ::std::chrono::high_resolution_clock::now();
+
+        ::std::vector<::std::thread> threads;
+
+        for(uSys i = 0; i < ThreadCount; ++i)
+        {
+            threads.emplace_back(worker);
+        }
+
+        for(::std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        return ::std::chrono::duration_cast<::std::chrono::microseconds>(::std::chrono::high_resolution_clock::now() - begin).count();
+    };
+
+    FixedBlockAllocator<> lockedAllocator(64, ThreadCount * BatchSize * 2);
+    ::std::mutex lockedMutex;
+
+    const auto lockedTime = run(
+        [&]() { ::std::lock_guard lock(lockedMutex); return lockedAllocator.allocate(); },
+        [&](void* const block) { ::std::lock_guard lock(lockedMutex); lockedAllocator.Deallocate(block); }
+    );
+
+    ::tau::allocator::ThreadCachingBlockAllocator<> cachingAllocator(64, ThreadCount * BatchSize * 4);
+
+    const auto cachingTime = run(
+        [&]() { return cachingAllocator.Allocate(64); },
+        [&](void* const block) { cachingAllocator.Deallocate(block); }
+    );
+
+    ::tau::allocator::ConcurrentFixedBlockAllocator<> lockFreeAllocator(64, ThreadCount * BatchSize * 2);
+
+    const auto lockFreeTime = run(
+        [&]() { return lockFreeAllocator.allocate(); },
+        [&](void* const block) { lockFreeAllocator.Deallocate(block); }
+    );
+
+    ConPrinter::PrintLn(u"Locked Fixed Block: {}us", lockedTime);
+    ConPrinter::PrintLn(u"Thread Caching: {}us", cachingTime);
+    ConPrinter::PrintLn(u"Lock Free: {}us", lockFreeTime);
+    ConPrinter::PrintLn(u"Thread Caching Ratio: {}", static_cast<f64>(cachingTime) / static_cast<f64>(lockedTime));
+    ConPrinter::PrintLn(u"Lock Free Ratio: {}", static_cast<f64>(lockFreeTime) / static_cast<f64>(lockedTime));
+}
+
+static void LargePageReserveTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    const uSys pageSize = PageAllocator::PageSize();
+    const uSys largePageSize = PageAllocator::PageSize(PageKind::Large);
+
+    TAU_UNIT_TRUE(largePageSize >= pageSize, u8"Large pages are smaller than normal pages.");
+    TAU_UNIT_TRUE(PageAllocator::PageSize(PageKind::Huge) >= largePageSize, u8"Huge pages are smaller than large pages.");
+    TAU_UNIT_EQ(PageAllocator::RoundPageCount(1, PageKind::Large) * pageSize, largePageSize, u8"Page count was not rounded to a large page.");
+    TAU_UNIT_EQ(PageAllocator::RoundPageCount(3, PageKind::Normal), 3, u8"Normal page count was rounded.");
+
+    constexpr uSys PageCount = 1000;
+
+    u8* const pages = static_cast<u8*>(PageAllocator::Reserve(PageCount, PageKind::Large));
+
+    TAU_UNIT_NEQ(pages, nullptr, u8"Failed to reserve large pages.");
+
+    if(!pages)
+    {
+        return;
+    }
+
+    TAU_UNIT_EQ(reinterpret_cast<uPtr>(pages) % largePageSize, 0, u8"Reservation was not aligned to the large page size.");
+
+    (void) PageAllocator::CommitPages(pages, PageCount);
+
+    for(uSys i = 0; i < PageCount; ++i)
+    {
+        pages[i * pageSize] = static_cast<u8>(i);
+    }
+
+    uSys corruptCount = 0;
+
+    for(uSys i = 0; i < PageCount; ++i)
+    {
+        if(pages[i * pageSize] != static_cast<u8>(i))
+        {
+            ++corruptCount;
+        }
+    }
+
+    TAU_UNIT_EQ(corruptCount, 0, u8"Committed large pages did not retain their values.");
+
+    PageAllocator::Free(pages, PageCount, PageKind::Large);
+
+    ArrayList<u32> list(1 << 20, PageKind::Large);
+
+    for(u32 i = 0; i < 100000; ++i)
+    {
+        list.add(i);
+    }
+
+    TAU_UNIT_EQ(list[99999], 99999, u8"Large page ArrayList lost its contents.");
+}
+
+static void SizeClassRoundingTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    using ::tau::allocator::SizeClassAllocator;
+
+    TAU_UNIT_EQ(SizeClassAllocator::RoundedSize(1), 8, u8"Smallest class is not 8 bytes.");
+    TAU_UNIT_EQ(SizeClassAllocator::RoundedSize(9), 16, u8"Did not round up to 16.");
+    TAU_UNIT_EQ(SizeClassAllocator::RoundedSize(100), 112, u8"Did not round up to a multiple of 16.");
+    TAU_UNIT_EQ(SizeClassAllocator::RoundedSize(128), 128, u8"Class size was rounded up.");
+    TAU_UNIT_EQ(SizeClassAllocator::RoundedSize(129), 160, u8"Did not round up to a quarter step.");
+    TAU_UNIT_EQ(SizeClassAllocator::RoundedSize(1000), 1024, u8"Did not round up to a quarter step.");
+    TAU_UNIT_EQ(SizeClassAllocator::RoundedSize(1025), 1280, u8"Did not round up to a quarter step.");
+    TAU_UNIT_EQ(SizeClassAllocator::RoundedSize(SizeClassAllocator::MaxSmallSize), SizeClassAllocator::MaxSmallSize, u8"Largest class is not MaxSmallSize.");
+
+    uSys badCount = 0;
+
+    for(uSys size = 1; size <= SizeClassAllocator::MaxSmallSize; ++size)
+    {
+        const uSys rounded = SizeClassAllocator::RoundedSize(size);
+
+        // Every class wastes at most a quarter of the request, beyond the first few.
+        if(rounded < size || (size > 16 && rounded - size > size / 4 + 16))
+        {
+            ++badCount;
+        }
+    }
+
+    TAU_UNIT_EQ(badCount, 0, u8"A size was rounded to an unsuitable class.");
+}
+
+static void SizeClassMixedTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys AllocationCount = 20000;
+
+    ::tau::allocator::SizeClassAllocator allocator;
+
+    ::std::mt19937 random(42);
+    ::std::uniform_int_distribution<uSys> sizeDistribution(1, 2048);
+
+    ::std::vector<u8*> blocks(AllocationCount);
+    ::std::vector<uSys> sizes(AllocationCount);
+
+    uSys nullCount = 0;
+    uSys misalignedCount = 0;
+
+    for(uSys i = 0; i < AllocationCount; ++i)
+    {
+        // Throw in the occasional large allocation.
+        sizes[i] = i % 1000 == 0 ? 100000 + i : sizeDistribution(random);
+        blocks[i] = static_cast<u8*>(allocator.Allocate(sizes[i]));
+
+        if(!blocks[i])
+        {
+            ++nullCount;
+            continue;
+        }
+
+        if(sizes[i] > 8 && reinterpret_cast<uPtr>(blocks[i]) % 16 != 0)
+        {
+            ++misalignedCount;
+        }
+
+        ::std::memset(blocks[i], static_cast<int>(i & 0xFF), sizes[i]);
+    }
+
+    TAU_UNIT_EQ(nullCount, 0, u8"Failed to allocate within the reservation.");
+    TAU_UNIT_EQ(misalignedCount, 0, u8"Objects were not 16 byte aligned.");
+
+    uSys corruptCount = 0;
+
+    // Free every other allocation, then refill the holes with different sizes.
+    for(uSys i = 0; i < AllocationCount; i += 2)
+    {
+        allocator.Deallocate(blocks[i]);
+        sizes[i] = sizeDistribution(random);
+        blocks[i] = static_cast<u8*>(allocator.Allocate(sizes[i]));
+        ::std::memset(blocks[i], static_cast<int>(i & 0xFF), sizes[i]);
+    }
+
+    for(uSys i = 0; i < AllocationCount; ++i)
+    {
+        for(uSys j = 0; j < sizes[i]; ++j)
+        {
+            if(blocks[i][j] != static_cast<u8>(i & 0xFF))
+            {
+                ++corruptCount;
+                break;
+            }
+        }
+
+        allocator.Deallocate(blocks[i]);
+    }
+
+    TAU_UNIT_EQ(corruptCount, 0, u8"Allocations overlapped.");
+}
+
+static void SizeClassRunReuseTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys AllocationCount = 4096;
+
+    ::tau::allocator::SizeClassAllocator allocator;
+
+    ::std::vector<void*> blocks(AllocationCount);
+
+    for(uSys i = 0; i < AllocationCount; ++i)
+    {
+        blocks[i] = allocator.Allocate(256);
+    }
+
+    const uSys runCount = allocator.RunCount();
+
+    for(uSys i = 0; i < AllocationCount; ++i)
+    {
+        allocator.Deallocate(blocks[i]);
+    }
+
+    // Runs freed by one class should be picked up by another.
+    for(uSys i = 0; i < AllocationCount; ++i)
+    {
+        blocks[i] = allocator.Allocate(200);
+    }
+
+    for(uSys i = 0; i < AllocationCount; ++i)
+    {
+        allocator.Deallocate(blocks[i]);
+    }
+
+    TAU_UNIT_EQ(allocator.RunCount(), runCount, u8"Free runs were not reused.");
+}
+
+static void SizeClassReserveFailureTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    // Far more address space than any system has.
+    constexpr uSys HugeSize = static_cast<uSys>(1) << 60;
+
+    {
+        ::tau::allocator::SizeClassAllocator allocator;
+        TAU_UNIT_EQ(allocator.Allocate(HugeSize), nullptr, u8"A large allocation that couldn't be mapped was not null.");
+        TAU_UNIT_EQ(allocator.Allocate(~static_cast<uSys>(0) - 8), nullptr, u8"A large allocation whose size overflowed was not null.");
+    }
+
+    {
+        ::tau::allocator::SizeClassAllocator allocator(static_cast<PageCountVal>(HugeSize / PageAllocator::PageSize()));
+        TAU_UNIT_EQ(allocator.Allocate(16), nullptr, u8"Allocating without a reservation was not null.");
+        TAU_UNIT_EQ(allocator.Allocate(1024 * 1024), nullptr, u8"Allocating without a reservation was not null.");
+    }
+}
+
+static void SizeClassPerfTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys RoundCount = 200;
+    constexpr uSys BatchSize = 4096;
+
+    ::std::mt19937 random(7);
+    ::std::uniform_int_distribution<uSys> sizeDistribution(8, 512);
+
+    ::std::vector<uSys> sizes(BatchSize);
+
+    for(uSys& size : sizes)
+    {
+        size = sizeDistribution(random);
+    }
+
+    const auto run = [&](TauAllocator& allocator)
+    {
+        ::std::vector<void*> blocks(BatchSize);
+
+        const auto begin = ::std::chrono::high_resolution_clock::now();
+
+        for(uSys round = 0; round < RoundCount; ++round)
+        {
+            for(uSys i = 0; i < BatchSize; ++i)
+            {
+                blocks[i] = allocator.Allocate(sizes[i]);
+            }
+
+            // Free in a different order than allocated.
+            for(uSys i = 0; i < BatchSize; ++i)
+            {
+                allocator.Deallocate(blocks[(i * 7) % BatchSize]);
+            }
+        }
+
+        return ::std::chrono::duration_cast<::std::chrono::microseconds>(::std::chrono::high_resolution_clock::now() - begin).count();
+    };
+
+    ::tau::allocator::SizeClassAllocator sizeClassAllocator;
+
+    const auto defaultTime = run(DefaultTauAllocator::Instance());
+    const auto sizeClassTime = run(sizeClassAllocator);
+
+    ConPrinter::PrintLn(u"Default: {}us", defaultTime);
+    ConPrinter::PrintLn(u"Size Class: {}us", sizeClassTime);
+    ConPrinter::PrintLn(u"Size Class Ratio: {}", static_cast<f64>(sizeClassTime) / static_cast<f64>(defaultTime));
+}
+
+static void NumaPlacementTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    const uSys nodeCount = PageAllocator::NumaNodeCount();
+
+    TAU_UNIT_TRUE(nodeCount >= 1, u8"There must be at least one NUMA node.");
+    TAU_UNIT_TRUE(PageAllocator::CurrentNumaNode() < nodeCount, u8"The current NUMA node is out of range.");
+
+    constexpr uSys PageCount = 16;
+
+    u8* const pages = static_cast<u8*>(PageAllocator::ReserveOnNode(PageCount, PageAllocator::CurrentNumaNode()));
+    (void) PageAllocator::CommitPagesOnNode(pages, PageCount, PageAllocator::CurrentNumaNode());
+    ::std::memset(pages, 0x5A, PageCount * PageAllocator::PageSize());
+
+    TAU_UNIT_EQ(pages[PageCount * PageAllocator::PageSize() - 1], 0x5A, u8"Node local pages were not committed.");
+
+    PageAllocator::Free(pages, PageCount);
+
+    constexpr uSys ThreadCount = 4;
+    constexpr uSys BlockCount = 256;
+
+    ::tau::allocator::NodeLocalBlockAllocator<AllocationTracking::Count> allocator(sizeof(uSys), BlockCount * ThreadCount);
+
+    TAU_UNIT_EQ(allocator.NodeCount(), nodeCount, u8"An arena was not created for every node.");
+
+    ::std::atomic<uSys> corruptCount(0);
+    ::std::atomic<uSys> nullCount(0);
+
+    const auto worker = [&](const uSys threadIndex)
+    {
+        void* blocks[BlockCount];
+
+        for(uSys i = 0; i < BlockCount; ++i)
+        {
+            blocks[i] = allocator.Allocate(sizeof(uSys));
+
+            if(!blocks[i])
+            {
+                nullCount.fetch_add(1, ::std::memory_order_relaxed);
+                continue;
+            }
+
+            *static_cast<uSys*>(blocks[i]) = threadIndex * BlockCount + i;
+        }
+
+        for(uSys i = 0; i < BlockCount; ++i)
+        {
+            if(blocks[i] && *static_cast<uSys*>(blocks[i]) != threadIndex * BlockCount + i)
+            {
+                corruptCount.fetch_add(1, ::std::memory_order_relaxed);
+            }
+
+            allocator.Deallocate(blocks[i]);
+        }
+    };
+
+    ::std::vector<::std::thread> threads;
+
+    for(uSys i = 0; i < ThreadCount; ++i)
+    {
+        threads.emplace_back(worker, i);
+    }
+
+    for(::std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    iSys allocationDifference = 0;
+
+    for(uSys i = 0; i < allocator.NodeCount(); ++i)
+    {
+        allocationDifference += allocator.Node(i)->allocationDifference();
+    }
+
+    TAU_UNIT_EQ(nullCount.load(), 0, u8"Failed to allocate within the per node reservation.");
+    TAU_UNIT_EQ(corruptCount.load(), 0, u8"A block was handed out twice.");
+    TAU_UNIT_EQ(allocationDifference, 0, u8"Blocks were not returned to their node.");
+}
+
+static void FileBackedPersistenceTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    const ::std::filesystem::path listPath = ::std::filesystem::temp_directory_path() / "TauUtilsFileBackedList.bin";
+    const ::std::filesystem::path treePath = ::std::filesystem::temp_directory_path() / "TauUtilsFileBackedTree.bin";
+
+    ::std::error_code error;
+    (void) ::std::filesystem::remove(listPath, error);
+    (void) ::std::filesystem::remove(treePath, error);
+
+    constexpr uSys ElementCount = 50000;
+
+    using TreeAllocator = StreamedAVLTreeAllocator<u64, u32, u8>;
+
+    {
+        ArrayList<u64> list(listPath.string().c_str(), ElementCount * 2);
+
+        TAU_UNIT_NEQ(list.arr(), nullptr, u8"Failed to open the backing file.");
+
+        if(!list.arr())
+        {
+            return;
+        }
+
+        for(uSys i = 0; i < ElementCount; ++i)
+        {
+            list.add(i * 7);
+        }
+    }
+
+    {
+        ArrayList<u64> list(listPath.string().c_str(), ElementCount * 2);
+
+        TAU_UNIT_EQ(list.count(), ElementCount, u8"Reopened list has the wrong count.");
+
+        uSys corruptCount = 0;
+
+        for(uSys i = 0; i < list.count(); ++i)
+        {
+            if(list[i] != i * 7)
+            {
+                ++corruptCount;
+            }
+        }
+
+        TAU_UNIT_EQ(corruptCount, 0, u8"Reopened list lost its elements.");
+
+        list.add(1);
+        list.flush();
+    }
+
+    {
+        ArrayList<u64> list(listPath.string().c_str(), ElementCount * 2);
+
+        TAU_UNIT_EQ(list.count(), ElementCount + 1, u8"List was not grown after reopening.");
+    }
+
+    {
+        TreeAllocator allocator(treePath.string().c_str(), ElementCount);
+
+        TAU_UNIT_TRUE(allocator.IsFileBacked(), u8"Failed to open the backing file.");
+        TAU_UNIT_EQ(allocator.PersistedRoot(), TreeAllocator::INVALID_VALUE, u8"New file has a root.");
+
+        for(uSys i = 0; i < ElementCount; ++i)
+        {
+            const uSys node = allocator.Allocate();
+            allocator.LeftTree()[node] = static_cast<u32>(i);
+            allocator.RightTree()[node] = static_cast<u32>(i + 1);
+            allocator.HeightTree()[node] = static_cast<u8>(i);
+            allocator.ValueTree()[node] = i * 3;
+        }
+
+        allocator.PersistRoot(42);
+    }
+
+    {
+        TreeAllocator allocator(treePath.string().c_str(), ElementCount);
+
+        TAU_UNIT_EQ(allocator.PersistedRoot(), 42, u8"Root was not persisted.");
+
+        uSys corruptCount = 0;
+
+        for(uSys i = 0; i < ElementCount; ++i)
+        {
+            if(allocator.LeftTree()[i] != i || allocator.RightTree()[i] != i + 1 || allocator.HeightTree()[i] != static_cast<u8>(i) || allocator.ValueTree()[i] != i * 3)
+            {
+                ++corruptCount;
+            }
+        }
+
+        TAU_UNIT_EQ(corruptCount, 0, u8"Reopened tree arrays lost their contents.");
+        TAU_UNIT_EQ(allocator.Allocate(), ElementCount, u8"Allocation state was not persisted.");
+    }
+
+    {
+        TreeAllocator allocator(treePath.string().c_str(), ElementCount);
+        allocator.PersistRoot(static_cast<u32>(ElementCount * 2));
+    }
+
+    {
+        TreeAllocator allocator(treePath.string().c_str(), ElementCount);
+
+        TAU_UNIT_EQ(allocator.PersistedRoot(), TreeAllocator::INVALID_VALUE, u8"A root past the allocated nodes was reused.");
+        TAU_UNIT_EQ(allocator.Allocate(), 0, u8"A tree with an invalid root was reused.");
+    }
+
+    // Files written with a different layout start over rather than being read at the wrong offsets.
+    {
+        ArrayList<u64> list(listPath.string().c_str(), ElementCount * 4);
+
+        TAU_UNIT_EQ(list.count(), 0, u8"List was reused with a different maxElements.");
+    }
+
+    {
+        TreeAllocator allocator(treePath.string().c_str(), ElementCount * 4);
+
+        TAU_UNIT_EQ(allocator.PersistedRoot(), TreeAllocator::INVALID_VALUE, u8"Tree was reused with a different maxElements.");
+        TAU_UNIT_EQ(allocator.Allocate(), 0, u8"Tree allocation state was reused with a different maxElements.");
+    }
+
+    (void) ::std::filesystem::remove(listPath, error);
+
+    {
+        // Every flag set, and every count far outside the reservation.
+        ::std::vector<u8> garbage(PageAllocator::PageSize(), 0xFF);
+
+        if(FILE* const file = ::std::fopen(listPath.string().c_str(), "wb"))
+        {
+            (void) ::std::fwrite(garbage.data(), 1, garbage.size(), file);
+            (void) ::std::fclose(file);
+        }
+
+        ArrayList<u64> list(listPath.string().c_str(), ElementCount);
+
+        TAU_UNIT_EQ(list.count(), 0, u8"A foreign file was used as a list.");
+    }
+
+    (void) ::std::filesystem::remove(listPath, error);
+    (void) ::std::filesystem::remove(treePath, error);
+}
+
+static void LinearArenaTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    using ::tau::allocator::LinearArenaAllocator;
+
+    LinearArenaAllocator arena(static_cast<PageCountVal>(64), 4);
+
+    uSys misalignedCount = 0;
+
+    for(uSys alignment = 1; alignment <= 4096; alignment *= 2)
+    {
+        void* const obj = arena.Allocate(3, alignment);
+
+        if(reinterpret_cast<uPtr>(obj) % alignment != 0)
+        {
+            ++misalignedCount;
+        }
+    }
+
+    TAU_UNIT_EQ(misalignedCount, 0, u8"Allocations were not aligned.");
+
+    const LinearArenaAllocator::Marker marker = arena.Mark();
+    void* const first = arena.Allocate(100);
+
+    {
+        LinearArenaAllocator::Scope scope(arena);
+        ::std::memset(arena.Allocate(100000), 0xCD, 100000);
+    }
+
+    TAU_UNIT_EQ(arena.Allocate(100), static_cast<u8*>(first) + 112, u8"Scope did not rewind the arena.");
+
+    arena.Rewind(marker);
+
+    TAU_UNIT_EQ(arena.Allocate(100), first, u8"Rewind did not reuse the freed space.");
+
+    TAU_UNIT_EQ(arena.Allocate(arena.ReservedPages() * PageAllocator::PageSize()), nullptr, u8"Allocated past the reservation.");
+
+    // Large enough that begin + size would wrap around.
+    const uSys usedBeforeOverflow = arena.BytesUsed();
+    TAU_UNIT_EQ(arena.Allocate(~static_cast<uSys>(0) - 100), nullptr, u8"An overflowing size was allocated.");
+    TAU_UNIT_EQ(arena.BytesUsed(), usedBeforeOverflow, u8"A failed allocation moved the arena.");
+
+    arena.Reset(true);
+
+    TAU_UNIT_EQ(arena.BytesUsed(), 0, u8"Reset did not free every allocation.");
+    TAU_UNIT_EQ(arena.CommittedPages(), 0, u8"Reset did not release the committed pages.");
+
+    u8* const afterReset = static_cast<u8*>(arena.Allocate(PageAllocator::PageSize() * 8));
+    ::std::memset(afterReset, 0xAB, PageAllocator::PageSize() * 8);
+
+    TAU_UNIT_EQ(afterReset[PageAllocator::PageSize() * 8 - 1], 0xAB, u8"Pages were not recommitted after reset.");
+
+    // Far more address space than any system has.
+    LinearArenaAllocator unreserved(static_cast<PageCountVal>((static_cast<uSys>(1) << 60) / PageAllocator::PageSize()));
+
+    TAU_UNIT_EQ(unreserved.Allocate(16), nullptr, u8"Allocated from an arena whose reservation failed.");
+}
+
+static void LinearArenaPerfTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys RequestCount = 20000;
+    constexpr uSys AllocationsPerRequest = 32;
+
+    ::std::mt19937 random(11);
+    ::std::uniform_int_distribution<uSys> sizeDistribution(8, 256);
+
+    uSys sizes[AllocationsPerRequest];
+
+    for(uSys& size : sizes)
+    {
+        size = sizeDistribution(random);
+    }
+
+    void* blocks[AllocationsPerRequest];
+
+    auto begin = ::std::chrono::high_resolution_clock::now();
+
+    for(uSys request = 0; request < RequestCount; ++request)
+    {
+        for(uSys i = 0; i < AllocationsPerRequest; ++i)
+        {
+            blocks[i] = DefaultTauAllocator::Instance().Allocate(sizes[i]);
+        }
+
+        for(uSys i = 0; i < AllocationsPerRequest; ++i)
+        {
+            DefaultTauAllocator::Instance().Deallocate(blocks[i]);
+        }
+    }
+
+    const auto defaultTime = ::std::chrono::duration_cast<::std::chrono::microseconds>(::std::chrono::high_resolution_clock::now() - begin).count();
+
+    ::tau::allocator::LinearArenaAllocator arena;
+
+    begin = ::std::chrono::high_resolution_clock::now();
+
+    for(uSys request = 0; request < RequestCount; ++request)
+    {
+        ::tau::allocator::LinearArenaAllocator::Scope scope(arena);
+
+        for(uSys i = 0; i < AllocationsPerRequest; ++i)
+        {
+            blocks[i] = arena.Allocate(sizes[i]);
+        }
+    }
+
+    const auto arenaTime = ::std::chrono::duration_cast<::std::chrono::microseconds>(::std::chrono::high_resolution_clock::now() - begin).count();
+
+    ConPrinter::PrintLn(u"Default: {}us", defaultTime);
+    ConPrinter::PrintLn(u"Linear Arena: {}us", arenaTime);
+    ConPrinter::PrintLn(u"Linear Arena Ratio: {}", static_cast<f64>(arenaTime) / static_cast<f64>(defaultTime));
+}
+
+static void ConcurrentRingBackpressureTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    using ::tau::allocator::ConcurrentRingAllocator;
+    using ::tau::allocator::RingProducerMode;
+
+    constexpr uSys SlotCount = 8;
+
+    ConcurrentRingAllocator<RingProducerMode::Single> ring(sizeof(uSys), SlotCount);
+
+    void* slots[SlotCount];
+
+    for(uSys i = 0; i < SlotCount; ++i)
+    {
+        slots[i] = ring.Allocate(sizeof(uSys));
+    }
+
+    TAU_UNIT_TRUE(ring.IsFull(), u8"Ring is not full after allocating every slot.");
+    TAU_UNIT_EQ(ring.Allocate(sizeof(uSys)), nullptr, u8"Allocated a slot that is still in use.");
+
+    // Slots are handed out in order, releasing a later slot doesn't make room.
+    ring.Deallocate(slots[3]);
+
+    TAU_UNIT_EQ(ring.Allocate(sizeof(uSys)), nullptr, u8"Allocated out of ring order.");
+
+    ring.Deallocate(slots[0]);
+
+    TAU_UNIT_EQ(ring.Allocate(sizeof(uSys)), slots[0], u8"Released slot was not reused.");
+    TAU_UNIT_EQ(ring.Allocate(sizeof(uSys)), nullptr, u8"Allocated a slot that is still in use.");
+
+    for(uSys i = 1; i < SlotCount; ++i)
+    {
+        if(i != 3)
+        {
+            ring.Deallocate(slots[i]);
+        }
+    }
+
+    TAU_UNIT_EQ(ring.Allocate(sizeof(uSys)), slots[1], u8"Released slot was not reused.");
+    TAU_UNIT_EQ(ring.Allocate(sizeof(uSys) + 1), nullptr, u8"Allocated a block larger than a slot.");
+}
+
+static void ConcurrentRingMultiProducerTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys ProducerCount = 3;
+    constexpr uSys ConsumerCount = 2;
+    constexpr uSys MessageCount = 20000;
+
+    ::tau::allocator::ConcurrentRingAllocator<::tau::allocator::RingProducerMode::Multi> ring(sizeof(uSys) * 2, 64);
+
+    ::std::mutex queueMutex;
+    ::std::vector<void*> queue;
+    ::std::atomic<uSys> consumedCount(0);
+    ::std::atomic<uSys> corruptCount(0);
+    ::std::atomic<uSys> backpressureCount(0);
+
+    const auto producer = [&](const uSys producerIndex)
+    {
+        for(uSys i = 0; i < MessageCount; ++i)
+        {
+            void* block;
+
+            while(!(block = ring.Allocate(sizeof(uSys) * 2)))
+            {
+                backpressureCount.fetch_add(1, ::std::memory_order_relaxed);
+                ::std::this_thread::yield();
+            }
+
+            static_cast<uSys*>(block)[0] = producerIndex * MessageCount + i;
+            static_cast<uSys*>(block)[1] = ~(producerIndex * MessageCount + i);
+
+            ::std::lock_guard lock(queueMutex);
+            queue.push_back(block);
+        }
+    };
+
+    // Consumers take messages from the back of the queue, releasing slots out of order.
+    const auto consumer = [&]()
+    {
+        while(consumedCount.load(::std::memory_order_relaxed) < ProducerCount * MessageCount)
+        {
+            void* block = nullptr;
+
+            {
+                ::std::lock_guard lock(queueMutex);
+
+                if(!queue.empty())
+                {
+                    block = queue.back();
+                    queue.pop_back();
+                }
+            }
+
+            if(!block)
+            {
+                ::std::this_thread::yield();
+                continue;
+            }
+
+            if(static_cast<uSys*>(block)[0] != ~static_cast<uSys*>(block)[1])
+            {
+                corruptCount.fetch_add(1, ::std::memory_order_relaxed);
+            }
+
+            ring.Deallocate(block);
+            consumedCount.fetch_add(1, ::std::memory_order_relaxed);
+        }
+    };
+
+    ::std::vector<::std::thread> threads;
+
+    for(uSys i = 0; i < ProducerCount; ++i)
+    {
+        threads.emplace_back(producer, i);
+    }
+
+    for(uSys i = 0; i < ConsumerCount; ++i)
+    {
+        threads.emplace_back(consumer);
+    }
+
+    for(::std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    TAU_UNIT_EQ(corruptCount.load(), 0, u8"A slot was handed out while still in use.");
+    TAU_UNIT_EQ(consumedCount.load(), ProducerCount * MessageCount, u8"Not every message was consumed.");
+    TAU_UNIT_FALSE(ring.IsFull(), u8"Released slots were not returned to the ring.");
+
+    ConPrinter::PrintLn(u"Ring Backpressure Retries: {}", backpressureCount.load());
+}
+
+static void AllocationProfileTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    ProfilingTauAllocator allocator;
+
+    void* small[4];
+
+    for(uSys i = 0; i < 4; ++i)
+    {
+        small[i] = allocator.AllocateAt(24);
+    }
+
+    void* const large = allocator.AllocateAt(1000);
+    void* const unattributed = allocator.Allocate(64);
+
+    const AllocationProfile& profile = allocator.Profile();
+
+    TAU_UNIT_EQ(profile.LiveBytes(), 4 * 24 + 1000 + 64, u8"Live bytes are incorrect.");
+    TAU_UNIT_EQ(profile.AllocationCount(), 6, u8"Allocation count is incorrect.");
+    TAU_UNIT_EQ(profile.Histogram(4), 4, u8"24 byte allocations were not placed in the [16, 32) bucket.");
+    TAU_UNIT_EQ(profile.Histogram(9), 1, u8"1000 byte allocation was not placed in the [512, 1024) bucket.");
+    TAU_UNIT_EQ(profile.Histogram(6), 1, u8"64 byte allocation was not placed in the [64, 128) bucket.");
+
+    uSys siteCount = 0;
+    uSys smallSiteLiveBytes = 0;
+    bool foundAddressSite = false;
+
+    for(uSys i = 0; i <= AllocationProfile::OverflowCallSite; ++i)
+    {
+        if(!profile.HasCallSite(i))
+        {
+            continue;
+        }
+
+        ++siteCount;
+        const AllocationProfile::CallSite& site = profile.GetCallSite(i);
+
+        if(site.AllocationCount.load() == 4)
+        {
+            smallSiteLiveBytes = site.LiveBytes.load();
+            TAU_UNIT_NEQ(site.File, nullptr, u8"Source location was not recorded.");
+        }
+        else if(!site.File)
+        {
+            foundAddressSite = site.Address != nullptr;
+        }
+    }
+
+    TAU_UNIT_EQ(siteCount, 3, u8"Each call site should have its own entry.");
+    TAU_UNIT_EQ(smallSiteLiveBytes, 4 * 24, u8"Call site live bytes are incorrect.");
+    TAU_UNIT_TRUE(foundAddressSite, u8"Return address was not recorded.");
+
+    allocator.Deallocate(large);
+
+    for(uSys i = 0; i < 4; ++i)
+    {
+        allocator.Deallocate(small[i]);
+    }
+
+    TAU_UNIT_EQ(profile.LiveBytes(), 64, u8"Live bytes were not released.");
+    TAU_UNIT_EQ(profile.PeakBytes(), 4 * 24 + 1000 + 64, u8"Peak bytes are incorrect.");
+    TAU_UNIT_EQ(profile.DeallocationCount(), 5, u8"Deallocation count is incorrect.");
+
+    const C8DynString json = WriteAllocationProfileJson(profile);
+
+    TAU_UNIT_TRUE(json.length() != 0 && json.c_str()[0] == u8'{', u8"Profile was not written as a JSON object.");
+
+    PrintAllocationProfile(profile);
+    ConPrinter::PrintLn("{}", json);
+
+    allocator.Deallocate(unattributed);
+
+    // There's no room to add the header to these sizes.
+    TAU_UNIT_EQ(allocator.Allocate(~static_cast<uSys>(0) - 8), nullptr, u8"An allocation too large for its header was made.");
+    TAU_UNIT_EQ(allocator.AllocateAt(~static_cast<uSys>(0) - 8), nullptr, u8"An allocation too large for its header was made.");
+    TAU_UNIT_EQ(profile.AllocationCount(), 6, u8"A failed allocation was recorded.");
+}
+
+namespace {
+
+struct alignas(64) OverAligned final
+{
+    u64 Value;
+};
+
+struct alignas(16) Aligned16 final
+{
+    u64 Low;
+    u64 High;
+};
+
+}
+
+static void TauMemoryResourceTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    ProfilingTauAllocator allocator;
+
+    {
+        TauMemoryResource resource(allocator);
+        ::std::pmr::vector<u32> vector(&resource);
+
+        for(u32 i = 0; i < 1000; ++i)
+        {
+            vector.push_back(i);
+        }
+
+        TAU_UNIT_EQ(vector[999], 999, u8"Vector contents are incorrect.");
+        TAU_UNIT_NEQ(allocator.Profile().AllocationCount(), 0, u8"Vector did not allocate through the resource.");
+        TAU_UNIT_EQ(allocator.Profile().LiveBytes(), vector.capacity() * sizeof(u32), u8"Vector storage is not accounted for.");
+
+        void* const aligned = resource.allocate(100, 256);
+        TAU_UNIT_EQ(reinterpret_cast<uPtr>(aligned) % 256, 0, u8"Over aligned allocation was not aligned.");
+        resource.deallocate(aligned, 100, 256);
+    }
+
+    TAU_UNIT_EQ(allocator.Profile().LiveBytes(), 0, u8"Not every allocation was returned.");
+}
+
+static void TauStdAllocatorTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    ProfilingTauAllocator allocator;
+
+    {
+        using MapAllocator = TauStdAllocator<::std::pair<const u32, u32>>;
+        using Map = ::std::unordered_map<u32, u32, ::std::hash<u32>, ::std::equal_to<u32>, MapAllocator>;
+
+        Map map(MapAllocator { allocator });
+
+        for(u32 i = 0; i < 100; ++i)
+        {
+            map[i] = i * 2;
+        }
+
+        TAU_UNIT_EQ(map[50], 100, u8"Map contents are incorrect.");
+        TAU_UNIT_TRUE(map.get_allocator() == TauStdAllocator<u8>(allocator), u8"Rebound allocators should compare equal.");
+        TAU_UNIT_NEQ(allocator.Profile().LiveBytes(), 0, u8"Map did not allocate through the adapter.");
+
+        ::std::vector<OverAligned, TauStdAllocator<OverAligned>> vector { TauStdAllocator<OverAligned>(allocator) };
+
+        for(u32 i = 0; i < 10; ++i)
+        {
+            vector.push_back({ i });
+            TAU_UNIT_EQ(reinterpret_cast<uPtr>(vector.data()) % 64, 0, u8"Over aligned element was not aligned.");
+        }
+    }
+
+    TAU_UNIT_EQ(allocator.Profile().LiveBytes(), 0, u8"Not every allocation was returned.");
+
+    {
+        // Blocks are only pointer aligned, every other 40 byte block is off by 8.
+        ::tau::allocator::ConcurrentFixedBlockAllocator<> blockAllocator(40, static_cast<uSys>(16));
+        TauStdAllocator<Aligned16> aligned16(blockAllocator);
+
+        Aligned16* blocks[4];
+        uSys misalignedCount = 0;
+
+        for(uSys i = 0; i < 4; ++i)
+        {
+            blocks[i] = aligned16.allocate(1);
+
+            if(reinterpret_cast<uPtr>(blocks[i]) % alignof(Aligned16) != 0)
+            {
+                ++misalignedCount;
+            }
+        }
+
+        TAU_UNIT_EQ(misalignedCount, 0, u8"Elements from a pointer aligned allocator were not aligned.");
+
+        for(uSys i = 0; i < 4; ++i)
+        {
+            aligned16.deallocate(blocks[i], 1);
+        }
+    }
+
+    TAU_UNIT_EQ(TauAllocatorUtils::AllocateAligned(allocator, ~static_cast<uSys>(0) - 8, 64), nullptr, u8"An aligned allocation whose padding overflowed was made.");
+}
+
+void AllocatorTests()
+{
+    ThreadCachingReuseTest();
+    ThreadCachingMultiThreadTest();
+    ConcurrentFixedBlockCrossThreadTest();
+    ConcurrentFixedBlockDoubleDeleteTest();
+    BlockAllocatorPerfTest();
+    SizeClassRoundingTest();
+    SizeClassMixedTest();
+    SizeClassRunReuseTest();
+    SizeClassReserveFailureTest();
+    SizeClassPerfTest();
+    LargePageReserveTest();
+    NumaPlacementTest();
+    FileBackedPersistenceTest();
+    LinearArenaTest();
+    LinearArenaPerfTest();
+    ConcurrentRingBackpressureTest();
+    ConcurrentRingMultiProducerTest();
+    AllocationProfileTest();
+    TauMemoryResourceTest();
+    TauStdAllocatorTest();
+}
@@ -1,9 +1,18 @@
 #include <ds/HashTable.hpp>
+#include <ds/SwissHashTable.hpp>
+#include <ds/ConcurrentHashTable.hpp>
+#include <ds/ConstexprPerfectHashMap.hpp>
+#include <ds/HashTableStatsDump.hpp>
 #include <ConPrinter.hpp>
+#include <json/JsonWriter.hpp>
 #include <TauUnit.hpp>
+#include <atomic>
 #include <chrono>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 #include <cstdlib>
+#include <algorithm>
 
 struct DirectHash final
 {
@@ -91,6 +100,865 @@ static void CollisionTest() noexcept
     }
 }
 
+static void PowerOfTwoInsertTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    ::tau::HashTable<DirectHash, uSys, ::tau::PowerOfTwoCapacityPolicy> hashTable;
+
+    constexpr uSys ElementCount = 20000;
+
+    for(uSys i = 0; i < ElementCount; ++i)
+    {
+        // Multiples of a large power of 2 only differ in their high bits, masking the raw hash would put them all in bucket 0.
+        hashTable.Insert(i << 20, i);
+    }
+
+    uSys foundCount = 0;
+    uSys correctCount = 0;
+    uSys missCount = 0;
+
+    for(uSys i = 0; i < ElementCount; ++i)
+    {
+        const uSys* const value = hashTable.Get(i << 20);
+
+        if(value)
+        {
+            ++foundCount;
+
+            if(*value == i)
+            {
+                ++correctCount;
+            }
+        }
+
+        if(!hashTable.Contains((i << 20) + 1))
+        {
+            ++missCount;
+        }
+    }
+
+    TAU_UNIT_EQ(foundCount, ElementCount, u8"Not every inserted key could be found.");
+    TAU_UNIT_EQ(correctCount, ElementCount, u8"Not every inserted key mapped to its value.");
+    TAU_UNIT_EQ(missCount, ElementCount, u8"Keys that were never inserted were found.");
+}
+
+static void RemoveTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    ::tau::HashTable<C8DynString, int> hashTable;
+
+    hashTable.Insert(u8"asdf", 64);
+    hashTable.Insert(u8"qwerty", 32);
+
+    TAU_UNIT_TRUE(hashTable.Remove(u8"asdf"), u8"Key \"asdf\" could not be removed.");
+    TAU_UNIT_FALSE(hashTable.Remove(u8"asdf"), u8"Key \"asdf\" was removed twice.");
+    TAU_UNIT_FALSE(hashTable.Contains(u8"asdf"), u8"Key \"asdf\" was found after removal.");
+    TAU_UNIT_EQ(hashTable.Count(), 1, u8"Element count was not decremented by removal.");
+
+    {
+        const int* const pQwerty = hashTable.Get(u8"qwerty");
+
+        TAU_UNIT_NEQ(pQwerty, nullptr, u8"Key \"qwerty\" could not be found after removing \"asdf\".");
+
+        if(pQwerty)
+        {
+            TAU_UNIT_EQ(*pQwerty, 32, u8"Key \"qwerty\" was not 32.");
+        }
+    }
+
+    hashTable.Insert(u8"asdf", 16);
+
+    {
+        const int* const pAsdf = hashTable.Get(u8"asdf");
+
+        TAU_UNIT_NEQ(pAsdf, nullptr, u8"Key \"asdf\" could not be found after reinsertion.");
+
+        if(pAsdf)
+        {
+            TAU_UNIT_EQ(*pAsdf, 16, u8"Key \"asdf\" was not 16.");
+        }
+    }
+}
+
+static void HeterogeneousLookupTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    ::tau::HashTable<C8DynString, int> hashTable;
+
+    hashTable.Insert(u8"asdf", 64);
+    hashTable.Insert(u8"qwerty", 32);
+
+    const C8DynString source(u8"key:asdf;");
+    const C8DynStringView view(source, 4, 8);
+    const c8* const pointer = u8"qwerty";
+
+    {
+        const int* const pAsdf = hashTable.Get(view);
+
+        TAU_UNIT_NEQ(pAsdf, nullptr, u8"Key \"asdf\" could not be found using a view.");
+
+        if(pAsdf)
+        {
+            TAU_UNIT_EQ(*pAsdf, 64, u8"Key \"asdf\" was not 64.");
+        }
+    }
+
+    {
+        const int* const pQwerty = hashTable.Get(pointer);
+
+        TAU_UNIT_NEQ(pQwerty, nullptr, u8"Key \"qwerty\" could not be found using a pointer.");
+
+        if(pQwerty)
+        {
+            TAU_UNIT_EQ(*pQwerty, 32, u8"Key \"qwerty\" was not 32.");
+        }
+    }
+
+    {
+        const int* const pAsdf = hashTable.GetWithHash(view.HashCode(), view);
+
+        TAU_UNIT_NEQ(pAsdf, nullptr, u8"Key \"asdf\" could not be found using a precomputed hash.");
+        TAU_UNIT_EQ(hashTable.GetWithHash(view.HashCode(), pointer), nullptr, u8"Found \"qwerty\" using the hash of \"asdf\".");
+    }
+
+    TAU_UNIT_FALSE(hashTable.Contains(C8DynStringView(source, 0, 3)), u8"Key \"key\" was found but never inserted.");
+    TAU_UNIT_TRUE(hashTable.Remove(view), u8"Key \"asdf\" could not be removed using a view.");
+    TAU_UNIT_FALSE(hashTable.Contains(u8"asdf"), u8"Key \"asdf\" was found after removal.");
+    TAU_UNIT_EQ(hashTable.Count(), 1, u8"Element count was not decremented by removal.");
+}
+
+static void GetBatchTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys ElementCount = 1000;
+    constexpr uSys LookupCount = 100;
+
+    ::tau::HashTable<DirectHash, uSys, ::tau::PowerOfTwoCapacityPolicy> hashTable;
+
+    for(uSys i = 0; i < ElementCount; ++i)
+    {
+        hashTable.Insert(i * 2, i);
+    }
+
+    // Every odd key is missing, and the count isn't a multiple of the batch size.
+    ::std::vector<DirectHash> keys;
+    uSys* values[LookupCount];
+
+    for(uSys i = 0; i < LookupCount; ++i)
+    {
+        keys.emplace_back(i * 7);
+    }
+
+    hashTable.GetBatch(keys, values);
+
+    uSys correctCount = 0;
+
+    for(uSys i = 0; i < LookupCount; ++i)
+    {
+        const uSys key = i * 7;
+
+        if(key % 2 == 0 ? values[i] && *values[i] == key / 2 : !values[i])
+        {
+            ++correctCount;
+        }
+    }
+
+    TAU_UNIT_EQ(correctCount, LookupCount, u8"Batched lookups did not match individual lookups.");
+
+    const auto& constTable = hashTable;
+    const uSys* constValues[LookupCount];
+    constTable.GetBatch(keys, constValues);
+
+    uSys matchCount = 0;
+
+    for(uSys i = 0; i < LookupCount; ++i)
+    {
+        if(constValues[i] == values[i])
+        {
+            ++matchCount;
+        }
+    }
+
+    TAU_UNIT_EQ(matchCount, LookupCount, u8"Const batched lookups did not match non-const batched lookups.");
+}
+
+static void GetBatchPerfTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    using Clock = ::std::chrono::high_resolution_clock;
+
+    constexpr uSys ElementCount = 1 << 22;
+    constexpr uSys LookupCount = 1 << 20;
+
+    ::tau::HashTable<DirectHash, uSys, ::tau::PowerOfTwoCapacityPolicy> hashTable(ElementCount);
+
+    for(uSys i = 0; i < ElementCount; ++i)
+    {
+        hashTable.Insert(i, i);
+    }
+
+    ::std::vector<DirectHash> keys;
+    ::std::vector<uSys*> values(LookupCount);
+    srand(0);
+
+    for(uSys i = 0; i < LookupCount; ++i)
+    {
+        keys.emplace_back(static_cast<uSys>(rand()) % ElementCount);
+    }
+
+    uSys serialSum = 0;
+    const auto serialBegin = Clock::now();
+
+    for(const DirectHash& key : keys)
+    {
+        serialSum += *hashTable.Get(key);
+    }
+
+    const auto serialEnd = Clock::now();
+
+    uSys batchSum = 0;
+    const auto batchBegin = Clock::now();
+
+    hashTable.GetBatch(keys, values);
+
+    for(const uSys* const value : values)
+    {
+        batchSum += *value;
+    }
+
+    const auto batchEnd = Clock::now();
+
+    TAU_UNIT_EQ(batchSum, serialSum, u8"Batched lookups did not match individual lookups.");
+
+    const iSys serialTime = (serialEnd - serialBegin).count() / 100;
+    const iSys batchTime = (batchEnd - batchBegin).count() / 100;
+
+    ConPrinter::PrintLn("Serial Get {}  Time: {}", LookupCount, serialTime);
+    ConPrinter::PrintLn("GetBatch   {}  Time: {}", LookupCount, batchTime);
+    ConPrinter::PrintLn("GetBatch   {} Ratio: {f3}", LookupCount, (static_cast<double>(batchTime) / static_cast<double>(serialTime)));
+}
+
+static constexpr auto Keywords = ::tau::MakePerfectHashMap<c8, int>({
+    { u8"if", 0 },
+    { u8"else", 1 },
+    { u8"while", 2 },
+    { u8"for", 3 },
+    { u8"return", 4 },
+    { u8"break", 5 },
+    { u8"continue", 6 },
+    { u8"switch", 7 },
+    { u8"case", 8 },
+    { u8"default", 9 },
+    { u8"Aa", 10 },
+    { u8"BB", 11 },
+});
+
+static_assert(*Keywords.Get(u8"return") == 4);
+static_assert(*Keywords.Get(u8"BB") == 11);
+static_assert(!Keywords.Contains(u8"do"));
+
+static void PerfectHashMapTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    static constexpr const c8* KeywordStrings[] = { u8"if", u8"else", u8"while", u8"for", u8"return", u8"break", u8"continue", u8"switch", u8"case", u8"default", u8"Aa", u8"BB" };
+
+    uSys foundCount = 0;
+
+    for(uSys i = 0; i < ::std::size(KeywordStrings); ++i)
+    {
+        const int* const value = Keywords.Get(KeywordStrings[i]);
+
+        if(value && *value == static_cast<int>(i))
+        {
+            ++foundCount;
+        }
+    }
+
+    TAU_UNIT_EQ(foundCount, Keywords.Count(), u8"Not every keyword mapped to its value.");
+
+    const C8DynString source(u8"key:continue;");
+    const C8DynStringView view(source, 4, 12);
+
+    {
+        const int* const pContinue = Keywords.Get(view);
+
+        TAU_UNIT_NEQ(pContinue, nullptr, u8"Key \"continue\" could not be found using a view.");
+
+        if(pContinue)
+        {
+            TAU_UNIT_EQ(*pContinue, 6, u8"Key \"continue\" was not 6.");
+        }
+    }
+
+    TAU_UNIT_FALSE(Keywords.Contains(C8DynStringView(source, 0, 3)), u8"Key \"key\" was found but never inserted.");
+    TAU_UNIT_FALSE(Keywords.Contains(u8"els"), u8"A prefix of \"else\" was found.");
+    TAU_UNIT_FALSE(Keywords.Contains(u8"elsee"), u8"An extension of \"else\" was found.");
+    TAU_UNIT_FALSE(Keywords.Contains(u8""), u8"The empty string was found.");
+}
+
+template<typename HashTableT>
+static void ChurnTest(HashTableT& hashTable, const uSys liveCount, const uSys roundCount) noexcept
+{
+    for(uSys i = 0; i < liveCount; ++i)
+    {
+        hashTable.Insert(i, i);
+    }
+
+    // Keep a sliding window of live keys, every round removes the oldest key and inserts a new one.
+    for(uSys i = 0; i < roundCount; ++i)
+    {
+        (void) hashTable.Remove(i);
+        hashTable.Insert(i + liveCount, i + liveCount);
+    }
+
+    uSys foundCount = 0;
+    uSys removedCount = 0;
+
+    for(uSys i = 0; i < liveCount; ++i)
+    {
+        const uSys* const value = hashTable.Get(roundCount + i);
+
+        if(value && *value == roundCount + i)
+        {
+            ++foundCount;
+        }
+
+        if(!hashTable.Contains(roundCount - i - 1))
+        {
+            ++removedCount;
+        }
+    }
+
+    TAU_UNIT_EQ(hashTable.Count(), liveCount, u8"Element count drifted under churn.");
+    TAU_UNIT_EQ(foundCount, liveCount, u8"Not every live key could be found after churn.");
+    TAU_UNIT_EQ(removedCount, liveCount, u8"Removed keys were still found after churn.");
+}
+
+static void RemoveChurnTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys LiveCount = 1000;
+
+    ::tau::HashTable<DirectHash, uSys> hashTable;
+    ChurnTest(hashTable, LiveCount, LiveCount * 100);
+
+    // The table should only ever need to grow enough to hold the live keys.
+    TAU_UNIT_LT(hashTable.BucketCount(), LiveCount * 4, u8"Tombstones caused the table to keep growing.");
+}
+
+template<typename HashTableT>
+static void ProbePolicyTest() noexcept
+{
+    constexpr uSys ElementCount = 1000;
+
+    HashTableT hashTable;
+
+    for(uSys i = 0; i < ElementCount; ++i)
+    {
+        hashTable.Insert(i, i);
+    }
+
+    uSys removedCount = 0;
+
+    // Remove every third key, the remaining keys have to be reachable across the holes.
+    for(uSys i = 0; i < ElementCount; i += 3)
+    {
+        if(hashTable.Remove(i))
+        {
+            ++removedCount;
+        }
+    }
+
+    TAU_UNIT_EQ(removedCount, (ElementCount + 2) / 3, u8"Not every key could be removed.");
+
+    uSys foundCount = 0;
+    removedCount = 0;
+
+    for(uSys i = 0; i < ElementCount; ++i)
+    {
+        const uSys* const value = hashTable.Get(i);
+
+        if(i % 3 == 0)
+        {
+            if(!value)
+            {
+                ++removedCount;
+            }
+        }
+        else if(value && *value == i)
+        {
+            ++foundCount;
+        }
+    }
+
+    TAU_UNIT_EQ(foundCount + removedCount, ElementCount, u8"Removal broke lookups of the remaining keys.");
+    TAU_UNIT_EQ(hashTable.Count(), ElementCount - (ElementCount + 2) / 3, u8"Element count was incorrect after removal.");
+
+    for(uSys i = 0; i < ElementCount; i += 3)
+    {
+        hashTable.Insert(i, i + 1);
+    }
+
+    foundCount = 0;
+
+    for(uSys i = 0; i < ElementCount; ++i)
+    {
+        const uSys* const value = hashTable.Get(i);
+
+        if(value && *value == (i % 3 == 0 ? i + 1 : i))
+        {
+            ++foundCount;
+        }
+    }
+
+    TAU_UNIT_EQ(foundCount, ElementCount, u8"Not every key could be found after reinsertion.");
+}
+
+static void LinearProbeTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    ProbePolicyTest<::tau::HashTable<DirectHash, uSys, ::tau::PrimeCapacityPolicy, ::tau::LinearProbePolicy>>();
+    ProbePolicyTest<::tau::HashTable<DirectHash, uSys, ::tau::PowerOfTwoCapacityPolicy, ::tau::LinearProbePolicy>>();
+
+    constexpr uSys LiveCount = 1000;
+
+    ::tau::HashTable<DirectHash, uSys, ::tau::PowerOfTwoCapacityPolicy, ::tau::LinearProbePolicy> hashTable;
+    ChurnTest(hashTable, LiveCount, LiveCount * 100);
+
+    TAU_UNIT_LT(hashTable.BucketCount(), LiveCount * 4, u8"Removal caused the table to keep growing.");
+}
+
+static void RobinHoodProbeTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    ProbePolicyTest<::tau::HashTable<DirectHash, uSys, ::tau::PrimeCapacityPolicy, ::tau::RobinHoodProbePolicy>>();
+    ProbePolicyTest<::tau::HashTable<DirectHash, uSys, ::tau::PowerOfTwoCapacityPolicy, ::tau::RobinHoodProbePolicy>>();
+
+    constexpr uSys LiveCount = 1000;
+
+    ::tau::HashTable<DirectHash, uSys, ::tau::PowerOfTwoCapacityPolicy, ::tau::RobinHoodProbePolicy> hashTable;
+    ChurnTest(hashTable, LiveCount, LiveCount * 100);
+
+    TAU_UNIT_LT(hashTable.BucketCount(), LiveCount * 4, u8"Removal caused the table to keep growing.");
+}
+
+static void RobinHoodLoadTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys ElementCount = 900;
+
+    ::tau::HashTable<DirectHash, uSys, ::tau::PowerOfTwoCapacityPolicy> quadraticTable;
+    ::tau::HashTable<DirectHash, uSys, ::tau::PowerOfTwoCapacityPolicy, ::tau::RobinHoodProbePolicy> robinHoodTable;
+
+    for(uSys i = 0; i < ElementCount; ++i)
+    {
+        quadraticTable.Insert(i, i);
+        robinHoodTable.Insert(i, i);
+    }
+
+    // 900 elements exceed a 75% load of 1024 buckets, but not a 90% load.
+    TAU_UNIT_EQ(quadraticTable.BucketCount(), 2048, u8"Quadratic probing should have grown past 1024 buckets.");
+    TAU_UNIT_EQ(robinHoodTable.BucketCount(), 1024, u8"Robin Hood probing should fit in 1024 buckets.");
+    TAU_UNIT_FALSE(robinHoodTable.Contains(ElementCount), u8"Found a key that was never inserted.");
+}
+
+static void StatisticsTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys ElementCount = 100;
+    constexpr uSys MissingCount = 10;
+
+    ::tau::HashTable<DirectHash, uSys, ::tau::PrimeCapacityPolicy, ::tau::LinearProbePolicy, ::tau::ImmediateRehashPolicy, ::tau::HashTableTracking::Probe> hashTable;
+
+    for(uSys i = 0; i < ElementCount; ++i)
+    {
+        hashTable.Insert(i, i);
+    }
+
+    for(uSys i = 0; i < ElementCount + MissingCount; ++i)
+    {
+        (void) hashTable.Contains(i);
+    }
+
+    {
+        const ::tau::HashTableStats stats = hashTable.Statistics();
+
+        u64 insertCount = 0;
+        u64 lookupCount = 0;
+
+        for(uSys i = 0; i < ::tau::HashTableStats::HistogramSize; ++i)
+        {
+            insertCount += stats.InsertProbeHistogram[i];
+            lookupCount += stats.LookupProbeHistogram[i];
+        }
+
+        TAU_UNIT_EQ(insertCount, ElementCount, u8"Not every insert was recorded.");
+        TAU_UNIT_EQ(lookupCount, ElementCount + MissingCount, u8"Not every lookup was recorded.");
+        TAU_UNIT_NEQ(stats.RehashCount, 0, u8"Growing from a single bucket didn't record a rehash.");
+        TAU_UNIT_EQ(stats.Count, ElementCount, u8"Count was not captured.");
+        TAU_UNIT_EQ(stats.LoadFactor(), static_cast<f64>(ElementCount) / static_cast<f64>(hashTable.BucketCount()), u8"Load factor was incorrect.");
+
+        // Sequential keys with an identity hash never leave their home bucket.
+        TAU_UNIT_EQ(stats.MaxInsertProbe, 0, u8"Sequential keys should not have collided.");
+    }
+
+    hashTable.ResetStatistics();
+
+    // Every key that is a multiple of the bucket count shares the home bucket of 0.
+    const uSys bucketCount = hashTable.BucketCount();
+    hashTable.Insert(bucketCount * 2, 0);
+
+    {
+        const ::tau::HashTableStats stats = hashTable.Statistics();
+
+        TAU_UNIT_EQ(stats.RehashCount, 0, u8"Statistics were not reset.");
+        TAU_UNIT_NEQ(stats.MaxInsertProbe, 0, u8"A colliding key did not record a probe.");
+
+        ::tau::json::JRoot jRoot = ::tau::json::JRoot::CreateObject();
+        StrongRef<::tau::json::JObject> root = jRoot.Get().AsObject();
+        ::tau::WriteHashTableStatsJson(stats, root);
+
+        TAU_UNIT_TRUE(root->Contains(C8DynString(u8"insertProbeHistogram")), u8"The JSON dump was missing the insert histogram.");
+    }
+}
+
+template<typename HashTableT>
+static void IncrementalRehashTest() noexcept
+{
+    constexpr uSys ElementCount = 5000;
+
+    HashTableT hashTable;
+
+    uSys rehashingInsertCount = 0;
+    uSys missingCount = 0;
+
+    for(uSys i = 0; i < ElementCount; ++i)
+    {
+        hashTable.Insert(i, i);
+
+        if(hashTable.IsRehashing())
+        {
+            ++rehashingInsertCount;
+
+            // Keys still in the old array and keys already migrated both have to be found.
+            for(uSys j = 0; j <= i; j += 97)
+            {
+                if(!hashTable.Contains(j))
+                {
+                    ++missingCount;
+                }
+            }
+        }
+    }
+
+    TAU_UNIT_GT(rehashingInsertCount, 0, u8"The table never rehashed incrementally.");
+    TAU_UNIT_EQ(missingCount, 0, u8"Keys went missing during an incremental rehash.");
+    TAU_UNIT_EQ(hashTable.Count(), ElementCount, u8"Element count was incorrect after inserting.");
+
+    uSys removedCount = 0;
+
+    for(uSys i = 0; i < ElementCount; i += 2)
+    {
+        if(hashTable.Remove(i))
+        {
+            ++removedCount;
+        }
+    }
+
+    uSys foundCount = 0;
+
+    for(uSys i = 0; i < ElementCount; ++i)
+    {
+        const uSys* const value = hashTable.Get(i);
+
+        if((i % 2 == 0) == !value && (!value || *value == i))
+        {
+            ++foundCount;
+        }
+    }
+
+    TAU_UNIT_EQ(removedCount, ElementCount / 2, u8"Not every key could be removed.");
+    TAU_UNIT_EQ(foundCount, ElementCount, u8"Table contents were incorrect after removal.");
+}
+
+static void IncrementalRehashPolicyTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    IncrementalRehashTest<::tau::HashTable<DirectHash, uSys, ::tau::PrimeCapacityPolicy, ::tau::QuadraticProbePolicy, ::tau::IncrementalRehashPolicy<4>>>();
+    IncrementalRehashTest<::tau::HashTable<DirectHash, uSys, ::tau::PowerOfTwoCapacityPolicy, ::tau::RobinHoodProbePolicy, ::tau::IncrementalRehashPolicy<4>>>();
+
+    constexpr uSys LiveCount = 1000;
+
+    ::tau::HashTable<DirectHash, uSys, ::tau::PrimeCapacityPolicy, ::tau::QuadraticProbePolicy, ::tau::IncrementalRehashPolicy<>> hashTable;
+    ChurnTest(hashTable, LiveCount, LiveCount * 100);
+
+    TAU_UNIT_LT(hashTable.BucketCount(), LiveCount * 4, u8"Tombstones caused the table to keep growing.");
+}
+
+template<typename HashTableT>
+static iSys WorstInsertTime(const uSys elementCount) noexcept
+{
+    using Clock = ::std::chrono::high_resolution_clock;
+
+    HashTableT hashTable;
+    iSys worstTime = 0;
+
+    for(uSys i = 0; i < elementCount; ++i)
+    {
+        const auto begin = Clock::now();
+        hashTable.Insert(i, i);
+        const auto end = Clock::now();
+
+        worstTime = ::std::max<iSys>(worstTime, (end - begin).count());
+    }
+
+    return worstTime;
+}
+
+static void RehashLatencyTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys ElementCount = 1000000;
+
+    const iSys immediateTime = WorstInsertTime<::tau::HashTable<DirectHash, uSys, ::tau::PowerOfTwoCapacityPolicy>>(ElementCount);
+    const iSys incrementalTime = WorstInsertTime<::tau::HashTable<DirectHash, uSys, ::tau::PowerOfTwoCapacityPolicy, ::tau::QuadraticProbePolicy, ::tau::IncrementalRehashPolicy<>>>(ElementCount);
+
+    ConPrinter::PrintLn("Immediate   Rehash Worst Insert {}  Time: {}", ElementCount, immediateTime);
+    ConPrinter::PrintLn("Incremental Rehash Worst Insert {}  Time: {}", ElementCount, incrementalTime);
+}
+
+static void SwissRemoveChurnTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys LiveCount = 1000;
+
+    ::tau::SwissHashTable<DirectHash, uSys> hashTable;
+    ChurnTest(hashTable, LiveCount, LiveCount * 100);
+
+    TAU_UNIT_LT(hashTable.Capacity(), LiveCount * 4, u8"Tombstones caused the table to keep growing.");
+}
+
+static void SwissInsertTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    ::tau::SwissHashTable<C8DynString, int> hashTable;
+
+    hashTable.Insert(u8"asdf", 64);
+    hashTable.Insert(u8"qwerty", 32);
+
+    {
+        const int* const pAsdf = hashTable.Get(u8"asdf");
+
+        TAU_UNIT_NEQ(pAsdf, nullptr, u8"Key \"asdf\" could not be found.");
+
+        if(pAsdf)
+        {
+            TAU_UNIT_EQ(*pAsdf, 64, u8"Key \"asdf\" was not 64.");
+        }
+    }
+
+    {
+        const int* const pQwerty = hashTable.Get(u8"qwerty");
+
+        TAU_UNIT_NEQ(pQwerty, nullptr, u8"Key \"qwerty\" could not be found.");
+
+        if(pQwerty)
+        {
+            TAU_UNIT_EQ(*pQwerty, 32, u8"Key \"qwerty\" was not 32.");
+        }
+    }
+
+    TAU_UNIT_FALSE(hashTable.Contains(u8"zxcv"), u8"Key \"zxcv\" was found but never inserted.");
+
+    hashTable.Insert(u8"asdf", 16);
+
+    {
+        const int* const pAsdf = hashTable.Get(u8"asdf");
+
+        TAU_UNIT_NEQ(pAsdf, nullptr, u8"Key \"asdf\" could not be found after replacement.");
+
+        if(pAsdf)
+        {
+            TAU_UNIT_EQ(*pAsdf, 16, u8"Key \"asdf\" was not replaced with 16.");
+        }
+    }
+
+    TAU_UNIT_EQ(hashTable.Count(), 2, u8"Replacing a key changed the element count.");
+}
+
+static void SwissGrowthTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys ElementCount = 10000;
+
+    ::tau::SwissHashTable<DirectHash, uSys> hashTable;
+
+    for(uSys i = 0; i < ElementCount; ++i)
+    {
+        // Multiples of the group width, these would all collide without hash mixing.
+        hashTable.Insert(i * 16, i);
+    }
+
+    TAU_UNIT_EQ(hashTable.Count(), ElementCount, u8"Element count did not match the number of inserted keys.");
+    TAU_UNIT_LTE(hashTable.Count(), hashTable.Capacity() - hashTable.Capacity() / 8, u8"Table exceeded the max load factor.");
+
+    uSys foundCount = 0;
+    uSys correctCount = 0;
+    uSys missCount = 0;
+
+    for(uSys i = 0; i < ElementCount; ++i)
+    {
+        const uSys* const value = hashTable.Get(i * 16);
+
+        if(value)
+        {
+            ++foundCount;
+
+            if(*value == i)
+            {
+                ++correctCount;
+            }
+        }
+
+        if(!hashTable.Contains(i * 16 + 1))
+        {
+            ++missCount;
+        }
+    }
+
+    TAU_UNIT_EQ(foundCount, ElementCount, u8"Not every inserted key could be found.");
+    TAU_UNIT_EQ(correctCount, ElementCount, u8"Not every inserted key mapped to its value.");
+    TAU_UNIT_EQ(missCount, ElementCount, u8"Keys that were never inserted were found.");
+}
+
+static void ConcurrentInsertTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    ::tau::ConcurrentHashTable<uSys, uSys> hashTable;
+
+    for(uSys i = 0; i < 1000; ++i)
+    {
+        hashTable.Insert(i, i);
+    }
+
+    TAU_UNIT_EQ(hashTable.Count(), 1000, u8"Element count was incorrect.");
+
+    hashTable.Insert(5, 55);
+    TAU_UNIT_EQ(hashTable.Count(), 1000, u8"Replacing a value changed the element count.");
+
+    uSys value = 0;
+    TAU_UNIT_TRUE(hashTable.TryGet(5, value), u8"Key 5 could not be found.");
+    TAU_UNIT_EQ(value, 55, u8"Key 5 did not have its value replaced.");
+
+    TAU_UNIT_TRUE(hashTable.Remove(5), u8"Key 5 could not be removed.");
+    TAU_UNIT_FALSE(hashTable.Contains(5), u8"Key 5 was found after removal.");
+    TAU_UNIT_FALSE(hashTable.TryGet(5, value), u8"Key 5 was found after removal.");
+    TAU_UNIT_EQ(value, 55, u8"A failed lookup modified the output value.");
+    TAU_UNIT_EQ(hashTable.Count(), 999, u8"Element count was incorrect after removal.");
+}
+
+static void ConcurrentReadWriteTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys WriterCount = 4;
+    constexpr uSys ReaderCount = 4;
+    constexpr uSys KeysPerWriter = 20000;
+
+    ::tau::ConcurrentHashTable<uSys, uSys> hashTable;
+    ::std::atomic<uSys> writersDone(0);
+    ::std::atomic<uSys> tornReads(0);
+
+    ::std::thread writers[WriterCount];
+    ::std::thread readers[ReaderCount];
+
+    for(uSys i = 0; i < WriterCount; ++i)
+    {
+        writers[i] = ::std::thread([&hashTable, &writersDone, i]()
+        {
+            for(uSys j = 0; j < KeysPerWriter; ++j)
+            {
+                const uSys key = j * WriterCount + i;
+                hashTable.Insert(key, key * 3);
+
+                // Churn a few keys so readers also race with removal.
+                if(j % 4 == 0)
+                {
+                    (void) hashTable.Remove(key);
+                }
+            }
+
+            ++writersDone;
+        });
+    }
+
+    for(uSys i = 0; i < ReaderCount; ++i)
+    {
+        readers[i] = ::std::thread([&hashTable, &writersDone, &tornReads, i]()
+        {
+            uSys key = i;
+
+            while(writersDone.load() < WriterCount)
+            {
+                uSys value;
+
+                // Every value ever written is three times its key, anything else was torn.
+                if(hashTable.TryGet(key, value) && value != key * 3)
+                {
+                    ++tornReads;
+                }
+
+                key = (key + 7) % (KeysPerWriter * WriterCount);
+            }
+        });
+    }
+
+    for(::std::thread& writer : writers)
+    {
+        writer.join();
+    }
+
+    for(::std::thread& reader : readers)
+    {
+        reader.join();
+    }
+
+    TAU_UNIT_EQ(tornReads.load(), 0, u8"Readers observed a partially written value.");
+    TAU_UNIT_EQ(hashTable.Count(), KeysPerWriter * WriterCount * 3 / 4, u8"Element count was incorrect after concurrent writes.");
+
+    uSys foundCount = 0;
+
+    for(uSys key = 0; key < KeysPerWriter * WriterCount; ++key)
+    {
+        const bool shouldExist = (key / WriterCount) % 4 != 0;
+        uSys value;
+
+        if(hashTable.TryGet(key, value) == shouldExist && (!shouldExist || value == key * 3))
+        {
+            ++foundCount;
+        }
+    }
+
+    TAU_UNIT_EQ(foundCount, KeysPerWriter * WriterCount, u8"Table contents were incorrect after concurrent writes.");
+}
+
 static void PerfTest(const uSys elementCount) noexcept
 {
     using Clock = ::std::chrono::high_resolution_clock;
@@ -99,6 +967,9 @@ static void PerfTest(const uSys elementCount) noexcept
     constexpr uSys RetryCount = 10;
 
     iSys tauTimes[RetryCount];
+    iSys pow2Times[RetryCount];
+    iSys robinHoodTimes[RetryCount];
+    iSys swissTimes[RetryCount];
     iSys stdTimes[RetryCount];
 
     for(uSys i = 0; i < WarmupCount + RetryCount; ++i)
@@ -125,6 +996,72 @@ static void PerfTest(const uSys elementCount) noexcept
             }
         }
 
+        {
+            ::tau::HashTable<DirectHash, int, ::tau::PowerOfTwoCapacityPolicy> hashTable;
+            srand(0);
+
+            const auto begin = Clock::now();
+
+            for(uSys i = 0; i < elementCount; ++i)
+            {
+                const auto key = rand();
+                const auto value = rand();
+
+                hashTable.Insert(key, value);
+            }
+
+            const auto end = Clock::now();
+
+            if(i >= WarmupCount)
+            {
+                pow2Times[i - WarmupCount] = (end - begin).count() / 100;
+            }
+        }
+
+        {
+            ::tau::HashTable<DirectHash, int, ::tau::PowerOfTwoCapacityPolicy, ::tau::RobinHoodProbePolicy> hashTable;
+            srand(0);
+
+            const auto begin = Clock::now();
+
+            for(uSys i = 0; i < elementCount; ++i)
+            {
+                const auto key = rand();
+                const auto value = rand();
+
+                hashTable.Insert(key, value);
+            }
+
+            const auto end = Clock::now();
+
+            if(i >= WarmupCount)
+            {
+                robinHoodTimes[i - WarmupCount] = (end - begin).count() / 100;
+            }
+        }
+
+        {
+            ::tau::SwissHashTable<DirectHash, int> hashTable;
+            srand(0);
+
+            const auto begin = Clock::now();
+
+            for(uSys i = 0; i < elementCount; ++i)
+            {
+                const auto key = rand();
+                const auto value = rand();
+
+                hashTable.Insert(key, value);
+            }
+
+            const auto end = Clock::now();
+
+            if(i >= WarmupCount)
+            {
+                swissTimes[i - WarmupCount] = (end - begin).count() / 100;
+            }
+        }
+
         {
             ::std::unordered_map<DirectHash, int> hashTable;
             srand(0);
@@ -149,20 +1086,35 @@ static void PerfTest(const uSys elementCount) noexcept
     }
 
     uSys tauTime = 0;
+    uSys pow2Time = 0;
+    uSys robinHoodTime = 0;
+    uSys swissTime = 0;
     uSys stdTime = 0;
 
     for(uSys i = 0; i < RetryCount; ++i)
     {
         tauTime += tauTimes[i];
+        pow2Time += pow2Times[i];
+        robinHoodTime += robinHoodTimes[i];
+        swissTime += swissTimes[i];
         stdTime += stdTimes[i];
     }
 
     tauTime /= RetryCount;
+    pow2Time /= RetryCount;
+    robinHoodTime /= RetryCount;
+    swissTime /= RetryCount;
     stdTime /= RetryCount;
 
     ConPrinter::PrintLn("Tau HashTable     Insert {}  Time: {}", elementCount, tauTime);
+    ConPrinter::PrintLn("Tau HashTable Pow2 Insert {}  Time: {}", elementCount, pow2Time);
+    ConPrinter::PrintLn("Tau HashTable RH  Insert {}  Time: {}", elementCount, robinHoodTime);
+    ConPrinter::PrintLn("Tau SwissHashTable Insert {}  Time: {}", elementCount, swissTime);
     ConPrinter::PrintLn("std unordered_map Insert {}  Time: {}", elementCount, stdTime);
     ConPrinter::PrintLn("                  Insert {} Ratio: {f3}", elementCount, (static_cast<double>(tauTime) / static_cast<double>(stdTime)));
+    ConPrinter::PrintLn("              Pow2 Insert {} Ratio: {f3}", elementCount, (static_cast<double>(pow2Time) / static_cast<double>(stdTime)));
+    ConPrinter::PrintLn("                RH Insert {} Ratio: {f3}", elementCount, (static_cast<double>(robinHoodTime) / static_cast<double>(stdTime)));
+    ConPrinter::PrintLn("             Swiss Insert {} Ratio: {f3}", elementCount, (static_cast<double>(swissTime) / static_cast<double>(stdTime)));
 }
 
 static void PerfTest10() noexcept
@@ -205,6 +1157,24 @@ void HashMapTests()
 {
     InsertTest();
     CollisionTest();
+    PowerOfTwoInsertTest();
+    RemoveTest();
+    RemoveChurnTest();
+    HeterogeneousLookupTest();
+    GetBatchTest();
+    GetBatchPerfTest();
+    PerfectHashMapTest();
+    LinearProbeTest();
+    RobinHoodProbeTest();
+    RobinHoodLoadTest();
+    StatisticsTest();
+    IncrementalRehashPolicyTest();
+    RehashLatencyTest();
+    SwissInsertTest();
+    SwissGrowthTest();
+    SwissRemoveChurnTest();
+    ConcurrentInsertTest();
+    ConcurrentReadWriteTest();
     PerfTest10();
     PerfTest100();
     PerfTest1000();
@@ -13,6 +13,7 @@ extern void JsonTests();
 extern void SemVerTests();
 extern void SemVerParserTests();
 extern void HashMapTests();
+extern void AllocatorTests();
 
 int main(int argCount, char* args[]){
     Console::Create();
@@ -26,6 +27,7 @@ int main(int argCount, char* args[]){
     SemVerTests();
     SemVerParserTests();
     HashMapTests();
+    AllocatorTests();
 
     ::tau::TestContainer::Instance().PrintTotals();
 
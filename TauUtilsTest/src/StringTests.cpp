@@ -2,6 +2,14 @@
 #include <ConPrinter.hpp>
 #include <ToString.hpp>
 #include <TauUnit.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
 
 static void TestIterateCodeUnits()
 {
@@ -240,9 +248,492 @@ static void TestStringFormatLargeConst()
     }
 }
 
+/**
+ *   Advances a linear congruential generator, so the randomized
+ * tests see the same strings on every run. Returns a value in
+ * [0, bound).
+ */
+static u32 NextRandom(u32& seed, const u32 bound) noexcept
+{
+    seed = seed * 1664525u + 1013904223u;
+    return (seed >> 16) % bound;
+}
+
+/**
+ *   A random code point. A 2, 3 and 4 byte UTF-8 sequence are each
+ * picked one time in bound, the rest are ASCII from asciiBase.
+ */
+static c32 RandomCodePoint(u32& seed, const u32 bound, const c32 asciiBase) noexcept
+{
+    const u32 roll = NextRandom(seed, bound);
+
+    if(roll == 0) { return U'é'; }
+    if(roll == 1) { return U'€'; }
+    if(roll == 2) { return U'\U0001F600'; }
+    return static_cast<c32>(asciiBase + roll);
+}
+
+template<typename Char>
+static void TestSimdPrimitivesT()
+{
+    namespace simd = ::tau::string::simd;
+
+    alignas(64) Char lhs[256];
+    alignas(64) Char rhs[256];
+    Char needle[8];
+
+    u32 seed = 0x1234567u;
+
+    uSys failures = 0;
+
+    for(uSys offset = 0; offset < 4; ++offset)
+    {
+        for(uSys length = 0; length < 140; ++length)
+        {
+            Char* const str = lhs + offset;
+            Char* const other = rhs + (offset ^ 1);
+
+            // A small alphabet, so searches find partial matches.
+            for(uSys i = 0; i < length; ++i)
+            {
+                str[i] = static_cast<Char>(u8'a' + NextRandom(seed, 3));
+                other[i] = str[i];
+            }
+            str[length] = Char { 0 };
+            other[length] = Char { 0 };
+
+            if(length != 0)
+            {
+                other[NextRandom(seed, static_cast<u32>(length))] = static_cast<Char>(u8'a' + NextRandom(seed, 3));
+            }
+
+            const uSys needleLength = 1 + NextRandom(seed, 5);
+            for(uSys i = 0; i < needleLength; ++i)
+            {
+                needle[i] = static_cast<Char>(u8'a' + NextRandom(seed, 3));
+            }
+
+            if(simd::Length(str) != simd::scalar::Length(str)) { ++failures; }
+            if(simd::Mismatch(str, other, length) != simd::scalar::Mismatch(str, other, length)) { ++failures; }
+            if(simd::Find(str, length, static_cast<Char>(u8'c')) != simd::scalar::Find(str, length, static_cast<Char>(u8'c'))) { ++failures; }
+            if(simd::Find(str, length, needle, needleLength) != simd::scalar::Find(str, length, needle, needleLength)) { ++failures; }
+
+            const uSys mismatch = simd::scalar::Mismatch(str, other, length);
+            const i32 expected = mismatch == length ? 0 : (str[mismatch] < other[mismatch] ? -1 : 1);
+            if(simd::Compare(str, other) != expected) { ++failures; }
+
+            // Ending one string early, so the terminated compare stops on it.
+            if(length != 0)
+            {
+                other[NextRandom(seed, static_cast<u32>(length))] = Char { 0 };
+                if(simd::Compare(str, other) != simd::scalar::Compare(str, other)) { ++failures; }
+                if(simd::Compare(other, str) != simd::scalar::Compare(other, str)) { ++failures; }
+            }
+        }
+    }
+
+    TAU_UNIT_EQ(failures, 0, "SIMD string primitives did not match the scalar versions.");
+}
+
+static void TestSimdPrimitives()
+{
+    TAU_UNIT_TEST();
+
+    TestSimdPrimitivesT<c8>();
+    TestSimdPrimitivesT<c16>();
+    TestSimdPrimitivesT<c32>();
+    TestSimdPrimitivesT<char>();
+    TestSimdPrimitivesT<wchar_t>();
+}
+
+static void TestIndexOf()
+{
+    TAU_UNIT_TEST();
+
+    const C8DynString str(u8"the quick brown fox jumps over the lazy dog, the end");
+    const C8DynStringView view(str, 4, 19);
+
+    TAU_UNIT_EQ(str.IndexOf(u8'q'), 4, "Found the wrong character.");
+    TAU_UNIT_EQ(str.IndexOf(u8"the"), 0, "Found the wrong substring.");
+    TAU_UNIT_EQ(str.IndexOf(u8"the", 1), 31, "Searching from an index found the wrong substring.");
+    TAU_UNIT_EQ(str.IndexOf(C8DynString(u8"the end")), 45, "Found the wrong substring.");
+    TAU_UNIT_EQ(str.IndexOf(u8"cat"), C8DynString::NotFound, "Found a missing substring.");
+    TAU_UNIT_EQ(str.IndexOf(u8'z', 100), C8DynString::NotFound, "Searching past the end found a character.");
+
+    TAU_UNIT_EQ(view.IndexOf(u8'o'), 8, "Found the wrong character in a view.");
+    TAU_UNIT_EQ(view.IndexOf(u8"fox"), 12, "Found the wrong substring in a view.");
+    TAU_UNIT_EQ(view.IndexOf(u8"jumps"), C8DynStringView::NotFound, "Found a substring past the end of a view.");
+
+    TAU_UNIT_TRUE(view.Equals(u8"quick brown fox"), "View was not equal to its contents.");
+    TAU_UNIT_FALSE(view.Equals(u8"quick brown fox jumps"), "View was equal to a longer string.");
+    TAU_UNIT_TRUE(view.CompareTo(C8DynString(u8"quick brown fox jumps")) < 0, "View did not compare less than a longer string.");
+    TAU_UNIT_TRUE(str.CompareTo(view) > 0, "String did not compare greater than a view.");
+}
+
+static void TestTranscodeAscii()
+{
+    TAU_UNIT_TEST();
+
+    namespace utf8 = ::tau::string::utf8;
+
+    constexpr iSys Count = 300;
+
+    c32 source[Count];
+    c8 expected8[Count * 4];
+    iSys expected8Length = 0;
+
+    u32 seed = 0x7654321u;
+
+    // Mostly ASCII, with the occasional multi byte code point to break up the vectors.
+    for(iSys i = 0; i < Count; ++i)
+    {
+        source[i] = RandomCodePoint(seed, 64, U' ');
+        (void) utf8::EncodeCodePoint(source[i], expected8, expected8Length, Count * 4);
+    }
+
+    c8 str8[Count * 4];
+    c16 str16[Count * 2 + 1];
+    c16 flipped16[Count * 2 + 1];
+    c32 str32[Count];
+
+    const iSys length8 = utf8::Transform(source, str8, Count, Count * 4);
+    TAU_UNIT_EQ(length8, expected8Length, "UTF-32 to UTF-8 produced the wrong length.");
+    TAU_UNIT_TRUE(::std::memcmp(str8, expected8, static_cast<uSys>(expected8Length)) == 0, "UTF-32 to UTF-8 produced the wrong code units.");
+
+    TAU_UNIT_EQ(utf8::Transform(str8, str32, length8, Count), Count, "UTF-8 to UTF-32 produced the wrong length.");
+    TAU_UNIT_TRUE(::std::memcmp(str32, source, sizeof(source)) == 0, "UTF-8 to UTF-32 did not round trip.");
+
+    const iSys length16 = ::tau::string::utf8_16::Transform(str8, str16, length8, Count * 2 + 1, false, true);
+    const iSys flippedLength16 = ::tau::string::utf8_16::Transform(str8, flipped16, length8, Count * 2 + 1, true, true);
+    TAU_UNIT_EQ(length16, flippedLength16, "Flipping endianness changed the length.");
+
+    uSys flipMismatches = 0;
+    for(iSys i = 0; i < length16; ++i)
+    {
+        if(flipped16[i] != ::tau::string::utf16::FlipEndian(str16[i])) { ++flipMismatches; }
+    }
+    TAU_UNIT_EQ(flipMismatches, 0, "Flipped UTF-16 did not match.");
+
+    (void) ::std::memset(str32, 0, sizeof(str32));
+    TAU_UNIT_EQ(::tau::string::utf16::Transform(str16, str32, length16, Count), Count, "UTF-16 to UTF-32 produced the wrong length.");
+    TAU_UNIT_TRUE(::std::memcmp(str32, source, sizeof(source)) == 0, "UTF-16 to UTF-32 did not round trip.");
+
+    c16 fromUtf32[Count * 2];
+    TAU_UNIT_EQ(::tau::string::utf16::Transform(source, fromUtf32, Count, Count * 2, false, true), length16, "UTF-32 to UTF-16 produced the wrong length.");
+    TAU_UNIT_TRUE(::std::memcmp(fromUtf32, str16, static_cast<uSys>(length16) * sizeof(c16)) == 0, "UTF-32 to UTF-16 produced the wrong code units.");
+
+    c8 fromUtf16[Count * 4];
+    TAU_UNIT_EQ(::tau::string::utf8_16::Transform(str16, fromUtf16, length16, Count * 4, true), length8, "UTF-16 to UTF-8 produced the wrong length.");
+    TAU_UNIT_TRUE(::std::memcmp(fromUtf16, expected8, static_cast<uSys>(length8)) == 0, "UTF-16 to UTF-8 produced the wrong code units.");
+}
+
+static void TestCountCodeUnits()
+{
+    TAU_UNIT_TEST();
+
+    namespace utf8 = ::tau::string::utf8;
+    namespace utf16 = ::tau::string::utf16;
+    namespace utf8_16 = ::tau::string::utf8_16;
+
+    constexpr iSys Count = 500;
+
+    c32 source[Count + 1];
+    iSys expected8Length = 0;
+    iSys expected16Length = 0;
+
+    u32 seed = 0x1234567u;
+
+    // Dense enough that sequences regularly straddle the 64 byte chunks.
+    for(iSys i = 0; i < Count; ++i)
+    {
+        source[i] = RandomCodePoint(seed, 8, U'a');
+        expected8Length += source[i] <= 0x7F ? 1 : (source[i] <= 0x7FF ? 2 : (source[i] <= 0xFFFF ? 3 : 4));
+        expected16Length += source[i] <= 0xFFFF ? 1 : 2;
+    }
+    source[Count] = U'\0';
+
+    c8 str8[Count * 4 + 1];
+    c16 str16[Count * 2 + 1];
+
+    TAU_UNIT_EQ(utf8::CalculateCodeUnits(source, Count), expected8Length, "Counting UTF-32 as UTF-8 gave the wrong length.");
+    TAU_UNIT_EQ(utf16::CalculateCodeUnits(source, Count, 0, 0, true), expected16Length, "Counting UTF-32 as UTF-16 gave the wrong length.");
+
+    TAU_UNIT_EQ(utf8::Transform(source, str8, Count, Count * 4), expected8Length, "UTF-32 to UTF-8 produced the wrong length.");
+    TAU_UNIT_EQ(utf16::Transform(source, str16, Count, Count * 2, false, true), expected16Length, "UTF-32 to UTF-16 produced the wrong length.");
+    str8[expected8Length] = u8'\0';
+    str16[expected16Length] = u'\0';
+
+    TAU_UNIT_EQ(utf8::CalculateCodePoints(str8, expected8Length), Count, "Counting UTF-8 code points gave the wrong count.");
+    TAU_UNIT_EQ(utf8_16::CalculateCodeUnits(str8, expected8Length, 0, 0, true), expected16Length, "Counting UTF-8 as UTF-16 gave the wrong length.");
+    TAU_UNIT_EQ(utf16::CalculateCodePoints(str16, expected16Length), Count, "Counting UTF-16 code points gave the wrong count.");
+    TAU_UNIT_EQ(utf8_16::CalculateCodeUnits(str16, expected16Length, 0, 0, true), expected8Length, "Counting UTF-16 as UTF-8 gave the wrong length.");
+
+    // Every prefix ends either inside or after a chunk, and on either side of a surrogate pair.
+    uSys prefixMismatches = 0;
+    iSys prefix8Length = 0;
+    iSys prefix16Length = 0;
+    for(iSys i = 0; i < Count; ++i)
+    {
+        if(utf8::CalculateCodePoints(str8, prefix8Length) != i) { ++prefixMismatches; }
+        if(utf16::CalculateCodePoints(str16, prefix16Length) != i) { ++prefixMismatches; }
+        if(i > 0 && utf8_16::CalculateCodeUnits(str16, prefix16Length, 0, 0, true) != prefix8Length) { ++prefixMismatches; }
+
+        prefix8Length += source[i] <= 0x7F ? 1 : (source[i] <= 0x7FF ? 2 : (source[i] <= 0xFFFF ? 3 : 4));
+        prefix16Length += source[i] <= 0xFFFF ? 1 : 2;
+    }
+    TAU_UNIT_EQ(prefixMismatches, 0, "Counting a prefix gave the wrong length.");
+
+    // A stray continuation byte is left to the scalar loop, which rejects it.
+    {
+        iSys stray = 100;
+        while((str8[stray] & 0x80) != 0) { ++stray; }
+
+        const c8 replaced = str8[stray];
+        str8[stray] = 0xBF;
+        TAU_UNIT_EQ(utf8::CalculateCodePoints(str8, expected8Length), -1, "A stray continuation byte was counted.");
+        str8[stray] = replaced;
+    }
+
+    // Casting to UTF-32 transcodes in a single pass.
+    const DynStringT<c8> fromUtf8 = StringCast<c8>(DynStringT<c32>(static_cast<const c32*>(source)));
+    const DynStringT<c32> toUtf32 = StringCast<c32>(fromUtf8);
+    TAU_UNIT_EQ(fromUtf8.Length(), static_cast<uSys>(expected8Length), "Casting to UTF-8 produced the wrong length.");
+    TAU_UNIT_EQ(toUtf32.Length(), static_cast<uSys>(Count), "Casting UTF-8 to UTF-32 produced the wrong length.");
+    TAU_UNIT_TRUE(::std::memcmp(toUtf32.String(), source, sizeof(source)) == 0, "Casting UTF-8 to UTF-32 did not round trip.");
+
+    const DynStringT<c32> fromUtf16 = StringCast<c32>(DynStringT<c16>(static_cast<const c16*>(str16)));
+    TAU_UNIT_EQ(fromUtf16.Length(), static_cast<uSys>(Count), "Casting UTF-16 to UTF-32 produced the wrong length.");
+    TAU_UNIT_TRUE(::std::memcmp(fromUtf16.String(), source, sizeof(source)) == 0, "Casting UTF-16 to UTF-32 did not round trip.");
+}
+
+static constexpr uSys LegacyStringHash(const char* const str, const uSys length) noexcept
+{
+    uSys hash = 0;
+    for(uSys i = 0; i < length; ++i)
+    {
+        hash = 31u * hash + static_cast<uSys>(str[i]);
+    }
+    return hash;
+}
+
+template<typename Char, uSys Len>
+static void StringHashConsistencyT(const Char(&str)[Len]) noexcept
+{
+    const uSys constHash = ConstExprStringT<Char>(str).HashCode();
+    const DynStringT<Char> dynString(str);
+
+    TAU_UNIT_EQ(dynString.HashCode(), constHash, u8"Runtime hash did not match the compile time hash.");
+    TAU_UNIT_EQ(DynStringViewT<Char>(dynString, 0, dynString.Length()).HashCode(), constHash, u8"View hash did not match the string hash.");
+}
+
+static void StringHashConsistencyTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    static_assert(C8ConstExprString(u8"asdf").HashCode() != C8ConstExprString(u8"asdg").HashCode());
+    static_assert(C8ConstExprString(u8"").HashCode() == ::cexpr::findHashCode(u8""));
+
+    // Lengths either side of each block size in the hash.
+    StringHashConsistencyT(u8"");
+    StringHashConsistencyT(u8"abc");
+    StringHashConsistencyT(u8"abcd");
+    StringHashConsistencyT(u8"0123456789abcdef");
+    StringHashConsistencyT(u8"0123456789abcdefg");
+    StringHashConsistencyT(u8"0123456789abcdef0123456789abcdef0123456789abcdef");
+    StringHashConsistencyT(u8"0123456789abcdef0123456789abcdef0123456789abcdefg");
+    StringHashConsistencyT(u8"The quick brown fox jumps over the lazy dog, then jumps back over the lazy dog again.");
+    StringHashConsistencyT(u"0123456789abcdefg");
+    StringHashConsistencyT(U"0123456789abcdefg");
+    StringHashConsistencyT(L"0123456789abcdefg");
+
+    bool switched = false;
+
+    STR_SWITCH(C8DynString(u8"release"), {
+        C8STR_CASE(u8"debug", { })
+        C8STR_CASE(u8"release", { switched = true; })
+    }, { });
+
+    TAU_UNIT_TRUE(switched, u8"STR_SWITCH did not match a case.");
+}
+
+static void StringHashQualityTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    constexpr uSys KeyCount = 1 << 16;
+    constexpr uSys BucketCount = 1 << 16;
+
+    // Checked on the 64 bit hash, truncated to a 32 bit uSys these keys
+    // would likely collide, and the legacy hash would fail every check.
+    ::std::vector<u64> hashes(KeyCount);
+    ::std::vector<uSys> legacyHashes(KeyCount);
+    ::std::vector<u8> buckets(BucketCount);
+    ::std::vector<u8> legacyBuckets(BucketCount);
+
+    char key[32];
+
+    for(uSys i = 0; i < KeyCount; ++i)
+    {
+        const int length = snprintf(key, sizeof(key), "key_%zu", static_cast<size_t>(i));
+
+        hashes[i] = ::tau::string::hash::Hash64(key, static_cast<uSys>(length));
+        legacyHashes[i] = LegacyStringHash(key, static_cast<uSys>(length));
+
+        buckets[hashes[i] % BucketCount] = 1;
+        legacyBuckets[legacyHashes[i] % BucketCount] = 1;
+    }
+
+    const uSys usedBuckets = static_cast<uSys>(::std::count(buckets.begin(), buckets.end(), 1));
+    const uSys legacyUsedBuckets = static_cast<uSys>(::std::count(legacyBuckets.begin(), legacyBuckets.end(), 1));
+
+    ::std::sort(hashes.begin(), hashes.end());
+    const uSys collisions = static_cast<uSys>(hashes.end() - ::std::unique(hashes.begin(), hashes.end()));
+
+    // Flip every bit of a 24 byte key and count how many bits of the hash change.
+    char avalancheKey[24];
+    ::std::memset(avalancheKey, 'a', sizeof(avalancheKey));
+    const u64 baseHash = ::tau::string::hash::Hash64(avalancheKey, sizeof(avalancheKey));
+
+    uSys flippedBits = 0;
+
+    for(uSys i = 0; i < sizeof(avalancheKey) * 8; ++i)
+    {
+        avalancheKey[i / 8] ^= static_cast<char>(1 << (i % 8));
+        flippedBits += static_cast<uSys>(::std::popcount(baseHash ^ ::tau::string::hash::Hash64(avalancheKey, sizeof(avalancheKey))));
+        avalancheKey[i / 8] ^= static_cast<char>(1 << (i % 8));
+    }
+
+    const double averageFlipped = static_cast<double>(flippedBits) / static_cast<double>(sizeof(avalancheKey) * 8);
+
+    // A random hash fills 1 - 1/e of the buckets.
+    TAU_UNIT_EQ(collisions, 0, u8"Distinct keys produced the same hash.");
+    TAU_UNIT_TRUE(usedBuckets > BucketCount * 6 / 10, u8"Hash clusters in a modulo indexed table.");
+    TAU_UNIT_TRUE(averageFlipped > 30.0 && averageFlipped < 34.0, u8"Flipping an input bit doesn't flip half of the output bits.");
+
+    ConPrinter::PrintLn("Hash Buckets Used: {} / {}", usedBuckets, BucketCount);
+    ConPrinter::PrintLn("Legacy Hash Buckets Used: {} / {}", legacyUsedBuckets, BucketCount);
+    ConPrinter::PrintLn("Hash Avalanche: {f3} bits", averageFlipped);
+}
+
+static void StringHashPerfTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    using Clock = ::std::chrono::high_resolution_clock;
+
+    constexpr uSys LongLength = 1 << 20;
+    constexpr uSys LongRounds = 64;
+    constexpr uSys ShortLength = 16;
+    constexpr uSys ShortRounds = 1 << 20;
+
+    ::std::vector<char> buffer(LongLength);
+
+    for(uSys i = 0; i < LongLength; ++i)
+    {
+        buffer[i] = static_cast<char>('a' + i % 26);
+    }
+
+    // Accumulate the hashes so they aren't optimized away.
+    uSys sink = 0;
+
+    const auto hashBegin = Clock::now();
+    for(uSys i = 0; i < LongRounds; ++i)
+    {
+        buffer[0] = static_cast<char>(i);
+        sink += ::findHashCode(buffer.data(), LongLength);
+    }
+    const auto hashEnd = Clock::now();
+
+    const auto legacyBegin = Clock::now();
+    for(uSys i = 0; i < LongRounds; ++i)
+    {
+        buffer[0] = static_cast<char>(i);
+        sink += LegacyStringHash(buffer.data(), LongLength);
+    }
+    const auto legacyEnd = Clock::now();
+
+    const auto shortHashBegin = Clock::now();
+    for(uSys i = 0; i < ShortRounds; ++i)
+    {
+        sink += ::findHashCode(buffer.data() + i % 64, ShortLength);
+    }
+    const auto shortHashEnd = Clock::now();
+
+    const auto shortLegacyBegin = Clock::now();
+    for(uSys i = 0; i < ShortRounds; ++i)
+    {
+        sink += LegacyStringHash(buffer.data() + i % 64, ShortLength);
+    }
+    const auto shortLegacyEnd = Clock::now();
+
+    const iSys hashTime = (hashEnd - hashBegin).count() / 100;
+    const iSys legacyTime = (legacyEnd - legacyBegin).count() / 100;
+    const iSys shortHashTime = (shortHashEnd - shortHashBegin).count() / 100;
+    const iSys shortLegacyTime = (shortLegacyEnd - shortLegacyBegin).count() / 100;
+
+    ConPrinter::PrintLn("Hash 1MiB x{}  Time: {}", LongRounds, hashTime);
+    ConPrinter::PrintLn("Legacy 1MiB x{}  Time: {}", LongRounds, legacyTime);
+    ConPrinter::PrintLn("Hash 16B x{}  Time: {}", ShortRounds, shortHashTime);
+    ConPrinter::PrintLn("Legacy 16B x{}  Time: {}", ShortRounds, shortLegacyTime);
+    ConPrinter::PrintLn("Long Hash Ratio: {f3}", static_cast<double>(hashTime) / static_cast<double>(legacyTime));
+    ConPrinter::PrintLn("Short Hash Ratio: {f3}", static_cast<double>(shortHashTime) / static_cast<double>(shortLegacyTime));
+    ConPrinter::PrintLn("Sink: {}", sink);
+}
+
+static void StringLazyHashTest() noexcept
+{
+    TAU_UNIT_TEST();
+
+    C8StringBuilder builder;
+
+    for(uSys i = 0; i < 256; ++i)
+    {
+        builder.Append(u8"log line payload ");
+    }
+
+    const C8DynString string = builder.toString();
+    const C8DynString copy = string;
+    const uSys expected = ::findHashCode(string.String(), string.Length());
+
+    ::std::atomic<uSys> mismatches(0);
+    ::std::vector<::std::thread> threads;
+
+    for(uSys i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&]()
+        {
+            if(copy.HashCode() != expected)
+            {
+                mismatches.fetch_add(1);
+            }
+        });
+    }
+
+    for(::std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    TAU_UNIT_EQ(mismatches.load(), 0, u8"Concurrent hashes did not match.");
+    TAU_UNIT_EQ(string.HashCode(), expected, u8"Cached hash did not match.");
+    TAU_UNIT_TRUE(string.Equals(copy), u8"Copied string was not equal.");
+    TAU_UNIT_EQ(C8DynString(C8DynStringView(string, 4, 8)).HashCode(), C8DynString(u8"line").HashCode(), u8"Substring hash did not match.");
+    TAU_UNIT_TRUE(C8DynString().Equals(C8DynString(u8"")), u8"Empty strings were not equal.");
+    TAU_UNIT_EQ(C8DynString().HashCode(), C8ConstExprString(u8"").HashCode(), u8"Empty string hashes did not match.");
+    TAU_UNIT_FALSE(string.Equals(C8DynString(u8"log line")), u8"Different strings were equal.");
+}
+
 void StringTests()
 {
+    TestSimdPrimitives();
+    TestIndexOf();
+    TestTranscodeAscii();
+    TestCountCodeUnits();
     TestIterateCodeUnits();
+    StringHashConsistencyTest();
+    StringHashQualityTest();
+    StringHashPerfTest();
+    StringLazyHashTest();
     ToStringTests();
     TestStringBuilder();
     TestStringFormatSmall();